@@ -0,0 +1,146 @@
+#!/usr/bin/env python3
+"""
+Trampoline kernel benchmarks runner.
+
+Builds the benchmarks listed in benchmarkSequences.txt for a target, runs
+them (posix only) and collects the "BENCH {...}" report lines in a JSON
+results file. On the Cortex-M targets the benchmarks are built only: flash
+each one, capture its serial output in a log file and give the log files
+with --parse.
+
+With --baseline, the results are compared to a previous results file and
+the exit status is 1 when a benchmark regresses by more than --threshold
+percent, either in ops/s or in p99 latency.
+"""
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+
+BENCH_DIR = os.path.dirname(os.path.abspath(__file__))
+TRAMPOLINE_DIR = os.path.dirname(BENCH_DIR)
+
+# target name -> (goil target, directory of the target in benchmarks/machines)
+TARGETS = {
+    "posix": ("posix/linux", "posix"),
+    "stm32f303": ("cortex-m/armv7em/stm32f303",
+                  os.path.join("cortex-m", "armv7em", "stm32f303")),
+    "stm32l432": ("cortex-m/armv7em/stm32l432",
+                  os.path.join("cortex-m", "armv7em", "stm32l432")),
+}
+
+
+def read_sequence():
+    with open(os.path.join(BENCH_DIR, "benchmarkSequences.txt")) as f:
+        return [line.strip() for line in f
+                if line.strip() and not line.startswith("#")]
+
+
+def parse_reports(text):
+    """Returns the benchmark reports found in the output of a benchmark."""
+    reports = []
+    for line in text.splitlines():
+        start = line.find("BENCH ")
+        if start >= 0:
+            reports.append(json.loads(line[start + len("BENCH "):]))
+    return reports
+
+
+def build(name, target, goil):
+    goil_target, machine_dir = TARGETS[target]
+    env = dict(os.environ)
+    env["GOIL_INCLUDE_PATH"] = os.path.join(BENCH_DIR, "machines", machine_dir)
+    env.setdefault("GOIL_TEMPLATES",
+                   os.path.join(TRAMPOLINE_DIR, "goil", "templates"))
+    cwd = os.path.join(BENCH_DIR, name)
+    subprocess.run([goil, "--target=" + goil_target, name + ".oil"],
+                   cwd=cwd, env=env, check=True, stdout=subprocess.DEVNULL)
+    subprocess.run([sys.executable, "make.py"],
+                   cwd=cwd, env=env, check=True, stdout=subprocess.DEVNULL)
+
+
+def run(name, timeout):
+    exe = os.path.join(BENCH_DIR, name, name + "_exe")
+    result = subprocess.run([exe], cwd=os.path.dirname(exe), timeout=timeout,
+                            stdout=subprocess.PIPE, universal_newlines=True)
+    return parse_reports(result.stdout)
+
+
+def compare(results, baseline, threshold):
+    """Prints the comparison and returns the number of regressions."""
+    reference = {r["benchmark"]: r for r in baseline["results"]}
+    regressions = 0
+    for result in results["results"]:
+        ref = reference.get(result["benchmark"])
+        if ref is None:
+            continue
+        ops = 100.0 * (result["ops_per_sec"] - ref["ops_per_sec"]) \
+            / max(ref["ops_per_sec"], 1)
+        p99 = 100.0 * (result["latency_ns"].get("p99", 0)
+                       - ref["latency_ns"].get("p99", 0)) \
+            / max(ref["latency_ns"].get("p99", 0), 1)
+        regressed = ops < -threshold or p99 > threshold
+        regressions += regressed
+        print("{:<14} ops/s {:+7.1f}%  p99 {:+7.1f}%{}".format(
+            result["benchmark"], ops, p99, "  REGRESSION" if regressed else ""))
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("benchmarks", nargs="*",
+                        help="benchmarks to run (default: all)")
+    parser.add_argument("--target", choices=sorted(TARGETS), default="posix")
+    parser.add_argument("--goil", default="goil", help="goil executable")
+    parser.add_argument("--parse", nargs="+", metavar="LOG",
+                        help="collect the reports from log files instead "
+                             "of building and running the benchmarks")
+    parser.add_argument("--output", default="results.json",
+                        help="results file (default: results.json)")
+    parser.add_argument("--baseline", help="results file to compare with")
+    parser.add_argument("--threshold", type=float, default=10.0,
+                        help="regression threshold in percent (default: 10)")
+    parser.add_argument("--timeout", type=float, default=60.0,
+                        help="timeout of a benchmark run in seconds")
+    args = parser.parse_args()
+
+    reports = []
+    if args.parse:
+        for log in args.parse:
+            with open(log, errors="replace") as f:
+                reports += parse_reports(f.read())
+    else:
+        for name in args.benchmarks or read_sequence():
+            print("> " + name)
+            build(name, args.target, args.goil)
+            if args.target == "posix":
+                reports += run(name, args.timeout)
+        if args.target != "posix":
+            print("Benchmarks built, flash them and use --parse "
+                  "on their serial output.")
+            return 0
+
+    for report in reports:
+        latency = report["latency_ns"]
+        print("{:<14} {:>12} ops/s  p50 {:>8} ns  p99 {:>8} ns".format(
+            report["benchmark"], report["ops_per_sec"],
+            latency.get("p50", "-"), latency.get("p99", "-")))
+
+    results = {"target": args.target, "results": reports}
+    with open(args.output, "w") as f:
+        json.dump(results, f, indent=2)
+        f.write("\n")
+
+    if args.baseline:
+        with open(args.baseline) as f:
+            baseline = json.load(f)
+        if compare(results, baseline, args.threshold) > 0:
+            return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,62 @@
+/**
+ * @file com_message.c
+ *
+ * @section desc File description
+ *
+ * Trampoline kernel benchmarks: internal COM messages. An operation is a
+ * message, it carries its send date and the latency is the time from the
+ * SendMessage to the ReceiveMessage in the activated receiver.
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline OS
+ *
+ * Trampoline is copyright (c) IRCCyN 2005+
+ * Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the Lesser GNU Public Licence
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+#include "tpl_os.h"
+
+DeclareMessage(sm);
+DeclareMessage(rm);
+
+int main(void)
+{
+  benchArchInit();
+  StartOS(OSDEFAULTAPPMODE);
+  return 0;
+}
+
+TASK(sender)
+{
+  benchStart("com_message");
+  while (benchRunning())
+  {
+    uint32 send_date = benchNow();
+    SendMessage(sm, &send_date);
+  }
+  benchReport();
+  ShutdownOS(E_OK);
+}
+
+TASK(receiver)
+{
+  uint32 send_date;
+  if (ReceiveMessage(rm, &send_date) == E_OK)
+  {
+    benchSample(benchNow() - send_date);
+    benchOps(1);
+  }
+  TerminateTask();
+}
+
+/* End of file com_message.c */
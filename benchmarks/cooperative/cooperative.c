@@ -0,0 +1,84 @@
+/**
+ * @file cooperative.c
+ *
+ * @section desc File description
+ *
+ * Trampoline kernel benchmarks: cooperative scheduling. An operation is a
+ * ChainTask, the latency is the duration of a round from t1 to t5.
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline OS
+ *
+ * Trampoline is copyright (c) IRCCyN 2005+
+ * Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the Lesser GNU Public Licence
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+#include "tpl_os.h"
+
+#define TASKS_IN_RING 5
+
+DeclareTask(t1);
+DeclareTask(t2);
+DeclareTask(t3);
+DeclareTask(t4);
+DeclareTask(t5);
+
+static int started = 0;
+static uint32 round_date;
+
+int main(void)
+{
+  benchArchInit();
+  StartOS(OSDEFAULTAPPMODE);
+  return 0;
+}
+
+TASK(t1)
+{
+  if (!started)
+  {
+    started = 1;
+    benchStart("cooperative");
+  }
+  round_date = benchNow();
+  ChainTask(t2);
+}
+
+TASK(t2)
+{
+  ChainTask(t3);
+}
+
+TASK(t3)
+{
+  ChainTask(t4);
+}
+
+TASK(t4)
+{
+  ChainTask(t5);
+}
+
+TASK(t5)
+{
+  benchSample(benchNow() - round_date);
+  benchOps(TASKS_IN_RING);
+  if (benchRunning())
+  {
+    ChainTask(t1);
+  }
+  benchReport();
+  ShutdownOS(E_OK);
+}
+
+/* End of file cooperative.c */
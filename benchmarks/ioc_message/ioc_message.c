@@ -0,0 +1,62 @@
+/**
+ * @file ioc_message.c
+ *
+ * @section desc File description
+ *
+ * Trampoline kernel benchmarks: IOC between two OS-Applications. An
+ * operation is an IocSend/IocReceive pair, the message carries its send date
+ * and the latency is the time from the IocSend to the IocReceive.
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline OS
+ *
+ * Trampoline is copyright (c) IRCCyN 2005+
+ * Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the Lesser GNU Public Licence
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+#include "Os.h"
+
+DeclareTask(sender);
+
+int main(void)
+{
+  benchArchInit();
+  StartOS(OSDEFAULTAPPMODE);
+  return 0;
+}
+
+TASK(receiver)
+{
+  uint32 send_date;
+
+  benchStart("ioc_message");
+  while (benchRunning())
+  {
+    ActivateTask(sender);
+    if (IocReceive_bench_ioc(&send_date) == IOC_E_OK)
+    {
+      benchSample(benchNow() - send_date);
+      benchOps(1);
+    }
+  }
+  benchReport();
+  ShutdownOS(E_OK);
+}
+
+TASK(sender)
+{
+  IocSend_bench_ioc(benchNow());
+  TerminateTask();
+}
+
+/* End of file ioc_message.c */
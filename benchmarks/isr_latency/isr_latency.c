@@ -0,0 +1,64 @@
+/**
+ * @file isr_latency.c
+ *
+ * @section desc File description
+ *
+ * Trampoline kernel benchmarks: ISR to task latency. An operation is an
+ * interrupt, the latency is the time from the trigger of the interrupt by t1
+ * to the start of t2, activated by the ISR2.
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline OS
+ *
+ * Trampoline is copyright (c) IRCCyN 2005+
+ * Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the Lesser GNU Public Licence
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+#include "tpl_os.h"
+
+DeclareTask(t2);
+
+static volatile uint32 trigger_date;
+
+int main(void)
+{
+  benchArchInit();
+  StartOS(OSDEFAULTAPPMODE);
+  return 0;
+}
+
+TASK(t1)
+{
+  benchStart("isr_latency");
+  while (benchRunning())
+  {
+    trigger_date = benchNow();
+    benchTriggerIt();
+  }
+  benchReport();
+  ShutdownOS(E_OK);
+}
+
+ISR(benchIt)
+{
+  ActivateTask(t2);
+}
+
+TASK(t2)
+{
+  benchSample(benchNow() - trigger_date);
+  benchOps(1);
+  TerminateTask();
+}
+
+/* End of file isr_latency.c */
@@ -0,0 +1,192 @@
+/**
+ * @file benchCommon.c
+ *
+ * @section desc File description
+ *
+ * Trampoline kernel benchmarks: measurement and report functions. See
+ * benchCommon.h for description.
+ *
+ * The report does not use printf so that the same code runs on targets
+ * without a C library.
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline OS
+ *
+ * Trampoline is copyright (c) IRCCyN 2005+
+ * Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the Lesser GNU Public Licence
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+#include "tpl_os.h"
+
+/* Duration of a benchmark run */
+#ifndef BENCH_DURATION_MS
+#define BENCH_DURATION_MS 1000
+#endif
+
+/* When more samples are recorded, the oldest ones are overwritten */
+#ifndef BENCH_SAMPLE_COUNT
+#define BENCH_SAMPLE_COUNT 1024
+#endif
+
+#define BENCH_LINE_SIZE 320
+
+static const char *bench_name = "";
+static uint32 bench_start_date = 0;
+static uint32 bench_elapsed = 0;
+static uint32 bench_duration = 0;
+static int bench_stopped = 0;
+static unsigned long long bench_ops = 0;
+
+/* circular buffer of the latency samples */
+static uint32 bench_samples[BENCH_SAMPLE_COUNT];
+static uint32 bench_sample_total = 0;
+
+static char bench_line[BENCH_LINE_SIZE];
+static uint32 bench_line_length = 0;
+
+void benchStart(const char *name)
+{
+  bench_name = name;
+  bench_ops = 0;
+  bench_sample_total = 0;
+  bench_stopped = 0;
+  bench_elapsed = 0;
+  bench_duration = benchMsToTicks(BENCH_DURATION_MS);
+  bench_start_date = benchNow();
+}
+
+int benchRunning(void)
+{
+  if (!bench_stopped)
+  {
+    const uint32 elapsed = benchNow() - bench_start_date;
+    if (elapsed >= bench_duration)
+    {
+      bench_stopped = 1;
+      bench_elapsed = elapsed;
+    }
+  }
+  return !bench_stopped;
+}
+
+void benchOps(uint32 count)
+{
+  bench_ops += count;
+}
+
+void benchSample(uint32 ticks)
+{
+  bench_samples[bench_sample_total % BENCH_SAMPLE_COUNT] = ticks;
+  bench_sample_total++;
+}
+
+/*
+ * Shell sort of the recorded samples, the percentiles are read in the
+ * sorted array.
+ */
+static void benchSortSamples(uint32 count)
+{
+  uint32 gap, i, j;
+
+  for (gap = count / 2; gap > 0; gap /= 2)
+  {
+    for (i = gap; i < count; i++)
+    {
+      const uint32 value = bench_samples[i];
+      for (j = i; (j >= gap) && (bench_samples[j - gap] > value); j -= gap)
+      {
+        bench_samples[j] = bench_samples[j - gap];
+      }
+      bench_samples[j] = value;
+    }
+  }
+}
+
+static void benchAppendString(const char *str)
+{
+  while ((*str != '\0') && (bench_line_length < (BENCH_LINE_SIZE - 1)))
+  {
+    bench_line[bench_line_length++] = *str++;
+  }
+  bench_line[bench_line_length] = '\0';
+}
+
+static void benchAppendNumber(unsigned long long value)
+{
+  char digits[21];
+  uint32 index = sizeof(digits) - 1;
+
+  digits[index] = '\0';
+  do
+  {
+    digits[--index] = (char)('0' + (value % 10));
+    value /= 10;
+  } while (value != 0);
+  benchAppendString(&digits[index]);
+}
+
+static void benchAppendField(const char *name, unsigned long long value)
+{
+  benchAppendString(",\"");
+  benchAppendString(name);
+  benchAppendString("\":");
+  benchAppendNumber(value);
+}
+
+static unsigned long long benchPercentile(uint32 count, uint32 percent)
+{
+  return benchTicksToNs(bench_samples[((count - 1) * percent) / 100]);
+}
+
+void benchReport(void)
+{
+  const uint32 count = (bench_sample_total < BENCH_SAMPLE_COUNT) ?
+                       bench_sample_total : BENCH_SAMPLE_COUNT;
+  unsigned long long elapsed_ns;
+
+  if (!bench_stopped)
+  {
+    bench_stopped = 1;
+    bench_elapsed = benchNow() - bench_start_date;
+  }
+  elapsed_ns = benchTicksToNs(bench_elapsed);
+  if (elapsed_ns == 0)
+  {
+    elapsed_ns = 1;
+  }
+
+  bench_line_length = 0;
+  benchAppendString("BENCH {\"benchmark\":\"");
+  benchAppendString(bench_name);
+  benchAppendString("\",\"target\":\"");
+  benchAppendString(BENCH_TARGET);
+  benchAppendString("\"");
+  benchAppendField("duration_ns", elapsed_ns);
+  benchAppendField("ops", bench_ops);
+  benchAppendField("ops_per_sec", (bench_ops * 1000000000ULL) / elapsed_ns);
+  benchAppendString(",\"latency_ns\":{\"samples\":");
+  benchAppendNumber(count);
+  if (count > 0)
+  {
+    benchSortSamples(count);
+    benchAppendField("min", benchTicksToNs(bench_samples[0]));
+    benchAppendField("p50", benchPercentile(count, 50));
+    benchAppendField("p90", benchPercentile(count, 90));
+    benchAppendField("p99", benchPercentile(count, 99));
+    benchAppendField("max", benchTicksToNs(bench_samples[count - 1]));
+  }
+  benchAppendString("}}\n");
+  benchPrint(bench_line);
+}
+
+/* End of file benchCommon.c */
@@ -0,0 +1,66 @@
+/**
+ * @file benchCommon.h
+ *
+ * @section desc File description
+ *
+ * Trampoline kernel benchmarks: measurement and report functions shared by
+ * all the benchmarks. A benchmark counts operations during BENCH_DURATION_MS
+ * milliseconds and records latency samples, the report is a single line
+ * starting with "BENCH " followed by a JSON object. The target may override
+ * BENCH_DURATION_MS and BENCH_SAMPLE_COUNT, the number of latency samples
+ * kept to compute the percentiles.
+ *
+ * The time base is given by the target (see archBench.h):
+ * - benchNow() returns the current time in ticks of the target;
+ * - benchTicksToNs() converts ticks to nanoseconds;
+ * - benchMsToTicks() converts milliseconds to ticks.
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline OS
+ *
+ * Trampoline is copyright (c) IRCCyN 2005+
+ * Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the Lesser GNU Public Licence
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+#ifndef BENCH_COMMON_H
+#define BENCH_COMMON_H
+
+/**
+ * Starts a benchmark run called name: resets the counters and arms the
+ * deadline.
+ */
+extern void benchStart(const char *name);
+
+/**
+ * Returns 1 until the duration of the run is elapsed.
+ */
+extern int benchRunning(void);
+
+/**
+ * Adds count operations to the run.
+ */
+extern void benchOps(uint32 count);
+
+/**
+ * Records a latency sample, in ticks of the target.
+ */
+extern void benchSample(uint32 ticks);
+
+/**
+ * Stops the run and prints its report.
+ */
+extern void benchReport(void);
+
+#endif /* BENCH_COMMON_H */
+
+/* End of file benchCommon.h */
@@ -0,0 +1,78 @@
+/**
+ * @file archBench.c
+ *
+ * @section desc File description
+ *
+ * Trampoline kernel benchmarks: ARMv7E-M targets. See archBench.h for
+ * description.
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline OS
+ *
+ * Trampoline is copyright (c) IRCCyN 2005+
+ * Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the Lesser GNU Public Licence
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+#include "tpl_os.h"
+#include BENCH_DEVICE_HEADER
+
+void benchArchInit(void)
+{
+  tpl_serial_begin();
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+uint32 benchNow(void)
+{
+  return DWT->CYCCNT;
+}
+
+unsigned long long benchTicksToNs(uint32 ticks)
+{
+  return ((unsigned long long)ticks * 1000ULL) / (SystemCoreClock / 1000000U);
+}
+
+uint32 benchMsToTicks(uint32 ms)
+{
+  return ms * (SystemCoreClock / 1000U);
+}
+
+void benchTriggerIt(void)
+{
+  NVIC_SetPendingIRQ(BENCH_IRQn);
+}
+
+void benchPrint(const char *line)
+{
+  /* the TX buffer of the serial library drops the characters when it is
+     full, wait for the USART interrupt to make room */
+  while (*line != '\0')
+  {
+    if (tpl_serial_putchar(*line) == 0)
+    {
+      line++;
+    }
+  }
+  /* the run ends with ShutdownOS, let the line go out first */
+  tpl_serial_wait_for_tx_complete();
+}
+
+/* the serial library uses a category 1 ISR (see arch.oil) */
+ISR(usart)
+{
+  itUsart();
+}
+
+/* End of file archBench.c */
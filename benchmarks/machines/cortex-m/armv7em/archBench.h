@@ -0,0 +1,60 @@
+/**
+ * @file archBench.h
+ *
+ * @section desc File description
+ *
+ * Trampoline kernel benchmarks: ARMv7E-M targets. The ticks are CPU cycles
+ * counted by the DWT cycle counter. The board gives its name and its CMSIS
+ * device header in benchBoard.h.
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline OS
+ *
+ * Trampoline is copyright (c) IRCCyN 2005+
+ * Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the Lesser GNU Public Licence
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+#ifndef ARCH_BENCH_H
+#define ARCH_BENCH_H
+
+#include "benchBoard.h"
+
+/* fewer samples on the small RAM of the Cortex-M boards */
+#define BENCH_SAMPLE_COUNT 256
+
+/**
+ * Initializes the cycle counter and the serial line. Called by main()
+ * before StartOS().
+ */
+extern void benchArchInit(void);
+
+extern uint32 benchNow(void);
+
+extern unsigned long long benchTicksToNs(uint32 ticks);
+
+extern uint32 benchMsToTicks(uint32 ms);
+
+/**
+ * Triggers the benchIt interrupt (see benchIT.oil) by setting it pending
+ * in the NVIC.
+ */
+extern void benchTriggerIt(void);
+
+/**
+ * Outputs a report line on the serial line of the board.
+ */
+extern void benchPrint(const char *line);
+
+#endif /* ARCH_BENCH_H */
+
+/* End of file archBench.h */
@@ -0,0 +1,37 @@
+/**
+ * @file benchBoard.h
+ *
+ * @section desc File description
+ *
+ * Trampoline kernel benchmarks: stm32f303 board (Nucleo-32).
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline OS
+ *
+ * Trampoline is copyright (c) IRCCyN 2005+
+ * Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the Lesser GNU Public Licence
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+#ifndef BENCH_BOARD_H
+#define BENCH_BOARD_H
+
+#define BENCH_TARGET        "stm32f303"
+#define BENCH_DEVICE_HEADER "stm32f3xx.h"
+
+/* the FPU interrupt is not used by the benchmarks, it is the source of
+   benchIt (see benchIT.oil) */
+#define BENCH_IRQn          FPU_IRQn
+
+#endif /* BENCH_BOARD_H */
+
+/* End of file benchBoard.h */
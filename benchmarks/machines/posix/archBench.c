@@ -0,0 +1,62 @@
+/**
+ * @file archBench.c
+ *
+ * @section desc File description
+ *
+ * Trampoline kernel benchmarks: posix target. See archBench.h for
+ * description.
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline OS
+ *
+ * Trampoline is copyright (c) IRCCyN 2005+
+ * Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the Lesser GNU Public Licence
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include "tpl_os.h"
+
+#include <signal.h>
+#include <stdio.h>
+#include <sys/types.h>
+#include <time.h>
+#include <unistd.h>
+
+void benchArchInit(void)
+{
+  /* output lines are read by benchmarks.py through a pipe */
+  setvbuf(stdout, NULL, _IOLBF, 0);
+}
+
+uint32 benchNow(void)
+{
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint32)(((unsigned long long)now.tv_sec * 1000000000ULL) +
+                  (unsigned long long)now.tv_nsec);
+}
+
+void benchTriggerIt(void)
+{
+  kill(getpid(), SIGUSR2);
+}
+
+void benchPrint(const char *line)
+{
+  fputs(line, stdout);
+  fflush(stdout);
+}
+
+/* End of file archBench.c */
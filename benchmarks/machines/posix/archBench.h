@@ -0,0 +1,53 @@
+/**
+ * @file archBench.h
+ *
+ * @section desc File description
+ *
+ * Trampoline kernel benchmarks: posix target. The ticks are nanoseconds
+ * of CLOCK_MONOTONIC.
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline OS
+ *
+ * Trampoline is copyright (c) IRCCyN 2005+
+ * Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the Lesser GNU Public Licence
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+#ifndef ARCH_BENCH_H
+#define ARCH_BENCH_H
+
+#define BENCH_TARGET "posix"
+
+/**
+ * Initializes the time base. Called by main() before StartOS().
+ */
+extern void benchArchInit(void);
+
+extern uint32 benchNow(void);
+
+#define benchTicksToNs(ticks) ((unsigned long long)(ticks))
+#define benchMsToTicks(ms)    ((uint32)(ms) * 1000000U)
+
+/**
+ * Triggers the benchIt interrupt (see benchIT.oil).
+ */
+extern void benchTriggerIt(void);
+
+/**
+ * Outputs a report line.
+ */
+extern void benchPrint(const char *line);
+
+#endif /* ARCH_BENCH_H */
+
+/* End of file archBench.h */
@@ -0,0 +1,80 @@
+/**
+ * @file preemptive.c
+ *
+ * @section desc File description
+ *
+ * Trampoline kernel benchmarks: preemptive scheduling. An operation is a
+ * preemption, the latency is the duration of a round: t1 activates t2 which
+ * preempts it and so on up to t5, then the tasks terminate back to t1.
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline OS
+ *
+ * Trampoline is copyright (c) IRCCyN 2005+
+ * Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the Lesser GNU Public Licence
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+#include "tpl_os.h"
+
+#define PREEMPTIONS_BY_ROUND 4
+
+DeclareTask(t2);
+DeclareTask(t3);
+DeclareTask(t4);
+DeclareTask(t5);
+
+int main(void)
+{
+  benchArchInit();
+  StartOS(OSDEFAULTAPPMODE);
+  return 0;
+}
+
+TASK(t1)
+{
+  benchStart("preemptive");
+  while (benchRunning())
+  {
+    const uint32 round_date = benchNow();
+    ActivateTask(t2);
+    benchSample(benchNow() - round_date);
+    benchOps(PREEMPTIONS_BY_ROUND);
+  }
+  benchReport();
+  ShutdownOS(E_OK);
+}
+
+TASK(t2)
+{
+  ActivateTask(t3);
+  TerminateTask();
+}
+
+TASK(t3)
+{
+  ActivateTask(t4);
+  TerminateTask();
+}
+
+TASK(t4)
+{
+  ActivateTask(t5);
+  TerminateTask();
+}
+
+TASK(t5)
+{
+  TerminateTask();
+}
+
+/* End of file preemptive.c */
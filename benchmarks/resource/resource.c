@@ -0,0 +1,58 @@
+/**
+ * @file resource.c
+ *
+ * @section desc File description
+ *
+ * Trampoline kernel benchmarks: resource locking. An operation is a
+ * GetResource/ReleaseResource pair, the latency is the duration of a pair.
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline OS
+ *
+ * Trampoline is copyright (c) IRCCyN 2005+
+ * Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the Lesser GNU Public Licence
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+#include "tpl_os.h"
+
+DeclareResource(res);
+
+int main(void)
+{
+  benchArchInit();
+  StartOS(OSDEFAULTAPPMODE);
+  return 0;
+}
+
+TASK(t1)
+{
+  benchStart("resource");
+  while (benchRunning())
+  {
+    const uint32 get_date = benchNow();
+    GetResource(res);
+    ReleaseResource(res);
+    benchSample(benchNow() - get_date);
+    benchOps(1);
+  }
+  benchReport();
+  ShutdownOS(E_OK);
+}
+
+/* t2 is never activated, it only sets the ceiling priority of res */
+TASK(t2)
+{
+  TerminateTask();
+}
+
+/* End of file resource.c */
@@ -0,0 +1,65 @@
+/**
+ * @file semaphore.c
+ *
+ * @section desc File description
+ *
+ * Trampoline kernel benchmarks: semaphore signaling. An operation is a
+ * SemPost/SemWait pair, the latency is the time from the SemPost of t1 to the
+ * return from SemWait in t2.
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline OS
+ *
+ * Trampoline is copyright (c) IRCCyN 2005+
+ * Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the Lesser GNU Public Licence
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+#include "tpl_os.h"
+
+DeclareTask(t2);
+DeclareSemaphore(sem);
+
+static uint32 post_date;
+
+int main(void)
+{
+  benchArchInit();
+  StartOS(OSDEFAULTAPPMODE);
+  return 0;
+}
+
+TASK(t1)
+{
+  /* t2 preempts t1 and blocks on the semaphore */
+  ActivateTask(t2);
+  benchStart("semaphore");
+  while (benchRunning())
+  {
+    post_date = benchNow();
+    SemPost(sem);
+  }
+  benchReport();
+  ShutdownOS(E_OK);
+}
+
+TASK(t2)
+{
+  while (1)
+  {
+    SemWait(sem);
+    benchSample(benchNow() - post_date);
+    benchOps(1);
+  }
+}
+
+/* End of file semaphore.c */
@@ -25,111 +25,79 @@
 #include "tpl_memmap.h"
 
 /*
- * tpl_send_static_external_message sends a message from a static external 
- * sending message object to an IPDU.
+ * tpl_send_static_external_message sends a message from a static external
+ * sending message object to its IPDU. The data is copied in the network
+ * message and the IPDU is packed by the goil generated copy and pack
+ * function. The internal receivers of the message, if any, get the data
+ * as for an internal message.
  * This function is attached to the sending message object.
  */
 FUNC(tpl_status, OS_CODE) tpl_send_static_external_message(
-  CONSTP2CONST(void, COM_CONST, AUTOMATIC)   smo,
-  P2VAR(tpl_com_data, COM_VAR, AUTOMATIC)    data)
+  CONSTP2CONST(void, AUTOMATIC, OS_CONST)       smo,
+  CONSTP2CONST(tpl_com_data, AUTOMATIC, OS_VAR) data)
 {
   VAR(tpl_status, AUTOMATIC) result = E_OK;
-  /* cast the base mo to the correct type of mo */
-  CONSTP2CONST(tpl_external_sending_mo, COM_CONST, AUTOMATIC) esmo = smo;
-  /* get the pointer to the data buffer */
-  CONSTP2VAR(tpl_com_data, COM_VAR, AUTOMATIC) mo_buf = esmo->buffer.buffer;
+  /*  cast the base mo to the correct type of mo  */
+  CONSTP2CONST(tpl_external_sending_mo, AUTOMATIC, OS_CONST) esmo = smo;
 
-  /* filter the message */
-  if (tpl_filtering(mo_buf, data, esmo->filter))
-  {
-#if WITH_CPU_ORDER_CALLOUT == YES
-    /* call the CPU-order message callout */
-    if (COM_TRUE == esmo->base_mo.cpu_callout())
-#endif
-    {
-      /*
-       * does the byte ordering of the message or not.
-       * If cpu order and network order differs, the data are ordered and
-       * copied from buffer.buffer to buffer.ordered_buffer. If cpu order
-       * and network order are the same, the data are simply copied from
-       * buffer.buffer to buffer.ordered_buffer.
-       */
-      esmo->order(&(esmo->buffer));
-
-#if WITH_NET_ORDER_CALLOUT == YES
-      /* call the Network-order message callout */
-      if (COM_TRUE == esmo->base_mo.net_callout())
-#endif
-      {
-
-        /* copy & pack the message object in the IPDU */
-        esmo->copy_and_pack(esmo);
-        /*
-         * notify the IPDU. According to the message property and
-         * the transfer property, this may trigger the sending of
-         * the IPDU to the network.
-         */
-        tpl_notify_ipdu(esmo->base_mo.property);
-
-      }
-    }
-  }
+  /*  copy & pack the message in the IPDU         */
+  esmo->copy_and_pack(data);
   /*
-   * if at least an internal target exists,
-   * the tpl_send_static_internal_message function is called
+   * notify the IPDU. According to the transmission mode of the IPDU, this
+   * may trigger the sending of the IPDU to the network.
    */
-  if (NULL != esmo->base_mo.internal.internal_target)
+  tpl_notify_ipdu(esmo->ipdu);
+
+  if (esmo->internal_mo.internal_target != NULL)
   {
-    result = tpl_send_static_internal_message(smo, data);
+    result = tpl_send_static_internal_message(&(esmo->internal_mo), data);
   }
-	return result;
+
+  return result;
 }
 
 /*
- * tpl_send_zero_external_message sends a zero size message from a zero 
- * external sending message object to an IPDU.
- * This function is attached to the sending message object.
+ * tpl_receive_external_message gives the value of a network message to
+ * an external receiving message object. It is called by the goil generated
+ * unpack function of the IPDU once the network message is unpacked. The
+ * data has the CDATATYPE of the receiving message object.
  */
-FUNC(tpl_status, OS_CODE) tpl_send_zero_external_message(
-  CONSTP2CONST(void, AUTOMATIC, OS_CONST)   smo,
-  P2VAR(tpl_com_data, AUTOMATIC, OS_VAR)    data)
+FUNC(void, OS_CODE) tpl_receive_external_message(
+  CONSTP2CONST(tpl_data_receiving_mo, AUTOMATIC, OS_CONST)  rmo,
+  P2CONST(tpl_com_data, AUTOMATIC, OS_VAR)                  data)
 {
-  VAR(tpl_status, AUTOMATIC) result = E_OK;
-  /* cast the base mo to the correct type of mo */
-  CONSTP2CONST(tpl_external_sending_zero_mo, AUTOMATIC, OS_CONST) esmo = smo;
+  CONSTP2CONST(tpl_filter_desc, AUTOMATIC, OS_CONST) filter = rmo->filter;
 
-#if WITH_CPU_ORDER_CALLOUT == YES
-    /* call the CPU-order message callout */
-    if (COM_TRUE == esmo->cpu_callout())
-#endif
+  /*
+   * A receiving mo with a NEVER filter, or whose NEW_VALUE filter rejects
+   * the data, never gets it. It is skipped without calling the receiving
+   * function, which does not evaluate a NEW_VALUE filter.
+   */
+  if ((filter == NULL) ||
+      ((filter->opcode != TPL_FILTER_NEVER) &&
+       ((filter->opcode != TPL_FILTER_NEW_VALUE) ||
+        filter->filter(filter, NULL, data))))
+  {
+    if (rmo->receiver(rmo, data) == E_OK)
     {
-#if WITH_NET_ORDER_CALLOUT == YES
-      /* call the Network-order message callout */
-      if (COM_TRUE == esmo->net_callout())
-#endif
+      tpl_action *notification = rmo->base_mo.notification;
+      if (notification != NULL)
       {
-        /*
-         * notify the IPDU. According to the message property and
-         * the transfer property, this may trigger the sending of
-         * the IPDU to the network.
-         */
-        tpl_notify_ipdu(esmo->property);
+        notification->action(notification);
       }
     }
-  /*
-   * if at least an internal target exists, the tpl_send_zero_internal_message
-   * function is called
-   */
-  if (NULL != esmo->internal.internal_target)
-  {
-    result = tpl_send_zero_internal_message(smo, data);
   }
-	return result;
 }
 
-FUNC(void, COM_CODE) tpl_notify_ipdu(
-  CONST(tpl_message_property, AUTOMATIC) property)
+/*
+ * tpl_notify_ipdu is called when a message has been packed in a sent IPDU.
+ * There is no lower layer to transmit the IPDU yet: the packed IPDU stays
+ * in its buffer until the lower layer reads it.
+ */
+FUNC(void, OS_CODE) tpl_notify_ipdu(
+  CONSTP2CONST(tpl_sending_ipdu, AUTOMATIC, OS_CONST) ipdu)
 {
+  (void)ipdu;
 }
 
 #define OS_STOP_SEC_CODE
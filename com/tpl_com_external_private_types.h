@@ -17,42 +17,32 @@
 #ifndef __TPL_COM_EXTERNAL_PRIVATE_TYPES_H__
 #define __TPL_COM_EXTERNAL_PRIVATE_TYPES_H__
 
+#include "tpl_com_mo.h"
+#include "tpl_com_ipdu.h"
+
 /*
- * tpl_external_sending_mo is external only sending message object
+ * Prototype of the copy and pack functions. They are generated by goil
+ * for each static external sending message object. They copy the data
+ * of the message in the value of its network message and pack the IPDU
+ * of the network message.
  */
-struct TPL_EXTERNAL_SENDING_MO {
-    /*  common to all sending mo            */
-    tpl_base_sending_mo     base_mo;
-    /*  function pointer to the filter      */
-    tpl_filter_desc         filter;
-    /*  pointer to the buffer               */
-    tpl_com_data            *buffer;
-    /*  pointer to the IPDU                 */
-    tpl_sending_ipdu        *external_target;
-    /*  location of the message in the IPDU */
-    tpl_ipdu_location       message_location;
-};
-
-typedef struct TPL_EXTERNAL_SENDING_MO tpl_external_sending_mo;
+typedef P2FUNC(void, OS_CODE, tpl_copy_and_pack_func)(
+  CONSTP2CONST(tpl_com_data, AUTOMATIC, OS_VAR) data);
 
 /*
- * tpl_internal_external_sending_mo is internal AND external
- * sending message object
+ * tpl_external_sending_mo is a static external sending message object.
+ * It starts with an internal sending message object so that internal
+ * receivers of the message are handled as for an internal message.
  */
-struct TPL_INTERNAL_EXTERNAL_SENDING_MO {
-    /*  common to all sending mo                            */
-    tpl_base_sending_mo             base_mo;
-    /*  function pointer to the filter                      */
-    tpl_filter                      filter;
-    /*  pointer to the buffer                               */
-    tpl_com_data                    *buffer;
-    /*  pointer to the internal receiving message object    */
-    struct TPL_BASE_RECEIVING_MO    *internal_target;
-    /*  pointer to the IPDU                                 */
-    struct TPL_SENDING_IPDU         *external_target;
+struct TPL_EXTERNAL_SENDING_MO {
+    /*  internal part, internal_target is NULL if no internal receiver  */
+    tpl_internal_sending_mo             internal_mo;
+    /*  copy the data in the network message and pack the IPDU          */
+    tpl_copy_and_pack_func              copy_and_pack;
+    /*  pointer to the IPDU                                             */
+    P2CONST(tpl_sending_ipdu, TYPEDEF, OS_CONST) ipdu;
 };
 
-typedef struct TPL_INTERNAL_EXTERNAL_SENDING_MO
-tpl_internal_external_sending_mo;
+typedef struct TPL_EXTERNAL_SENDING_MO tpl_external_sending_mo;
 
 #endif
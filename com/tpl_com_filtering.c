@@ -15,6 +15,7 @@
  */
 
 #include "tpl_com_filtering.h"
+#include "tpl_com_filters.h"
 #include "tpl_os_definitions.h"
 
 #define OS_START_SEC_CODE
@@ -23,21 +24,40 @@
  * tpl_filtering handles the filtering of messages.
  * It takes two data pointers (new_data and old_data),
  * If the check failed, tpl_filtering returns TRUE
+ *
+ * The opcode of the filter is decoded here so that the ALWAYS, NEVER and
+ * ONEEVERYN filters, which are the most common ones, do not need an
+ * indirect call. A NEW_VALUE filter has already been evaluated by the
+ * sender before the receiving function is called.
  */
 tpl_bool tpl_filtering(
   P2CONST(tpl_com_data, AUTOMATIC, OS_VAR)            old_data,
   P2CONST(tpl_com_data, AUTOMATIC, OS_VAR)            new_data,
   CONSTP2CONST(tpl_filter_desc, AUTOMATIC, OS_CONST)  filter_desc)
 {
-  
+  VAR(tpl_bool, AUTOMATIC) result = TRUE;
+
   /*  Checks there is a filter set */
-  if ((filter_desc != NULL) && (filter_desc->filter != NULL)) {
-    /*  Checks the data is compatible with filter. Size have
-        to be less or equal than the tpl_com_value data size    */
-    /*  Call the filter */
-    return filter_desc->filter(filter_desc, old_data, new_data);
+  if (filter_desc != NULL)
+  {
+    switch (filter_desc->opcode)
+    {
+      case TPL_FILTER_NEVER:
+        result = FALSE;
+        break;
+      case TPL_FILTER_ONE_EVERY_N:
+        result = tpl_filter_one_every_n(filter_desc, old_data, new_data);
+        break;
+      case TPL_FILTER_FUNCTION:
+        result = filter_desc->filter(filter_desc, old_data, new_data);
+        break;
+      default:
+        /*  TPL_FILTER_ALWAYS and TPL_FILTER_NEW_VALUE */
+        break;
+    }
   }
-  return TRUE;
+
+  return result;
 }
 #define OS_STOP_SEC_CODE
 #include "tpl_memmap.h"
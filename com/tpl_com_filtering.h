@@ -25,6 +25,32 @@
  */
 struct TPL_FILTER_DESC;
 
+/*
+ * Filter opcodes. goil compiles the filter of each receiving message object
+ * to one of these opcodes so that the trivial filters are evaluated inline
+ * by tpl_filtering without calling a function:
+ * - TPL_FILTER_ALWAYS: the message is always accepted
+ * - TPL_FILTER_NEVER: the message is always filtered out
+ * - TPL_FILTER_ONE_EVERY_N: occurence counting filter, the descriptor is a
+ *   tpl_occurence_filter_desc
+ * - TPL_FILTER_FUNCTION: the filter function of the descriptor is called.
+ *   goil generates it for each message with the mask, x, min and max
+ *   parameters folded as constants
+ * - TPL_FILTER_NEW_VALUE: like TPL_FILTER_FUNCTION, but the result depends
+ *   on the new value only (MASKEDNEWEQUALSX, MASKEDNEWDIFFERSX, NEWISWITHIN
+ *   and NEWISOUTSIDE). The receivers of a sending message with the same
+ *   filter share one descriptor and goil chains them one after the other,
+ *   so that the send evaluates the filter once for all of them before
+ *   calling their receiving functions
+ */
+typedef uint8 tpl_filter_opcode;
+
+#define TPL_FILTER_ALWAYS       0
+#define TPL_FILTER_NEVER        1
+#define TPL_FILTER_ONE_EVERY_N  2
+#define TPL_FILTER_FUNCTION     3
+#define TPL_FILTER_NEW_VALUE    4
+
 /*
  * filtering function pointer
  */
@@ -39,11 +65,13 @@ typedef tpl_bool (*tpl_filter_func)(
  * 
  *  \brief  Base structure of filter descriptor
  *
- *  This structure contains the pointer to the filter function only. It is
- *  the common part for the filter descriptor structures and is extended to
- *  add the filter parameters.
+ *  This structure contains the opcode of the filter and the pointer to the
+ *  filter function. It is the common part for the filter descriptor
+ *  structures and is extended to add the filter parameters.
  */
 struct TPL_FILTER_DESC {
+    /*  opcode of the filter                    */
+    const tpl_filter_opcode opcode ;
     /*  filtering function pointer  */
     const tpl_filter_func filter ;
 };
@@ -20,22 +20,6 @@
 #define OS_START_SEC_CODE
 #include "tpl_memmap.h"
 
-FUNC(tpl_bool, OS_CODE) tpl_filter_always(
-  CONSTP2CONST(tpl_filter_desc, AUTOMATIC, OS_CODE) fd,
-  CONSTP2CONST(void, AUTOMATIC, OS_VAR) old_value,
-  CONSTP2CONST(void, AUTOMATIC, OS_VAR) new_value)
-{
-  return TRUE;
-}
-
-FUNC(tpl_bool, OS_CODE) tpl_filter_never(
-  CONSTP2CONST(tpl_filter_desc, AUTOMATIC, OS_CODE) fd,
-  CONSTP2CONST(void, AUTOMATIC, OS_VAR) old_value,
-  CONSTP2CONST(void, AUTOMATIC, OS_VAR) new_value)
-{
-  return FALSE;
-}
-
 FUNC(tpl_bool, OS_CODE) tpl_filter_one_every_n(
   CONSTP2CONST(tpl_filter_desc, AUTOMATIC, OS_CODE) fd,
   CONSTP2CONST(void, AUTOMATIC, OS_VAR) old_value,
@@ -52,11 +52,43 @@ FUNC(tpl_status, OS_CODE) tpl_send_static_internal_message(
   /*  get the first of the receiving mo                                   */
   P2CONST(tpl_data_receiving_mo, AUTOMATIC, OS_CONST)
   rmo = (tpl_data_receiving_mo *)ismo->internal_target;
+  /*  last NEW_VALUE filter evaluated and its result                      */
+  P2CONST(tpl_filter_desc, AUTOMATIC, OS_CONST) new_value_filter = NULL;
+  VAR(tpl_bool, AUTOMATIC) new_value_result = TRUE;
 
   /*  iterate through the receiving mo to copy the data to the receivers  */
   while ((result == E_OK) && (rmo != NULL))
   {
-    result = rmo->receiver(rmo, data);
+    P2CONST(tpl_filter_desc, AUTOMATIC, OS_CONST) filter = rmo->filter;
+
+    /*
+     * The receivers sharing a NEW_VALUE filter are chained one after the
+     * other: the filter is evaluated for the first one and its result is
+     * used for the next ones.
+     */
+    if ((filter != NULL) &&
+        (filter->opcode == TPL_FILTER_NEW_VALUE) &&
+        (filter != new_value_filter))
+    {
+      new_value_filter = filter;
+      new_value_result = filter->filter(filter, NULL, data);
+    }
+
+    /*
+     * A receiving mo with a NEVER filter, or whose NEW_VALUE filter rejects
+     * the data, never gets it. It is skipped without calling the receiving
+     * function.
+     */
+    if ((filter != NULL) &&
+        ((filter->opcode == TPL_FILTER_NEVER) ||
+         ((filter == new_value_filter) && (new_value_result == FALSE))))
+    {
+      result = E_COM_FILTEREDOUT;
+    }
+    else
+    {
+      result = rmo->receiver(rmo, data);
+    }
   
     /*
      * Walk along the receiving message object chain and call the notification
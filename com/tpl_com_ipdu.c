@@ -0,0 +1,64 @@
+/*
+ * Trampoline OS
+ *
+ * Trampoline is copyright (c) IRCCyN 2005+
+ * Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the Lesser GNU Public Licence
+ *
+ * Trampoline IPDU reception. The frame is unpacked by the goil generated
+ * unpack function of the IPDU.
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+#include "tpl_com_ipdu.h"
+#include "tpl_os_definitions.h"
+#include "tpl_com_definitions.h"
+
+#define OS_START_SEC_CODE
+#include "tpl_memmap.h"
+
+/*
+ * tpl_receive_ipdu unpacks a frame in all the network messages of the
+ * IPDU ipdu_id. The frame has to be at least as long as the IPDU.
+ */
+FUNC(tpl_status, OS_CODE) tpl_receive_ipdu(
+  CONST(tpl_ipdu_id, AUTOMATIC)           ipdu_id,
+  CONSTP2CONST(uint8, AUTOMATIC, COM_VAR) frame,
+  CONST(tpl_ipdu_size, AUTOMATIC)         length)
+{
+  VAR(tpl_status, AUTOMATIC) result = E_COM_ID;
+
+#if RECEIVE_IPDU_COUNT > 0
+  if (ipdu_id < RECEIVE_IPDU_COUNT)
+  {
+    CONSTP2CONST(tpl_receiving_ipdu, AUTOMATIC, OS_CONST) ipdu =
+      tpl_receiving_ipdu_table[ipdu_id];
+
+    if (length < ipdu->size)
+    {
+      result = E_COM_LENGTH;
+    }
+    else
+    {
+      ipdu->unpack(frame);
+      result = E_OK;
+    }
+  }
+#else
+  (void)ipdu_id;
+  (void)frame;
+  (void)length;
+#endif
+
+  return result;
+}
+
+#define OS_STOP_SEC_CODE
+#include "tpl_memmap.h"
+
+/* End of file tpl_com_ipdu.c */
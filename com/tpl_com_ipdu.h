@@ -17,27 +17,100 @@
 #ifndef __TPL_COM_IPDU_H__
 #define __TPL_COM_IPDU_H__
 
-typedef u8  tpl_ipdu_mode;
+#include "tpl_os_internal_types.h"
+
+typedef uint8  tpl_ipdu_mode;
 
 #define IPDU_PERIODIC 1
 #define IPDU_DIRECT   2
 #define IPDU_MIXED    ((IPDU_PERIODIC) | (IPDU_DIRECT))
 
-typedef u32 tpl_ipdu_id;
+typedef uint32 tpl_ipdu_id;
+
+/*
+ * tpl_ipdu_size is the size of an IPDU in bytes. goil rejects IPDUs
+ * larger than TPL_IPDU_MAX_SIZE bytes.
+ */
+typedef uint16 tpl_ipdu_size;
+
+#define TPL_IPDU_MAX_SIZE 65535
+
+/*
+ * Prototype of the bulk pack functions. They are generated by goil
+ * for each sent IPDU and pack the current value of all the network
+ * messages of the IPDU in the IPDU buffer. Bit positions, lengths and
+ * byte ordering are resolved at generation time.
+ */
+typedef P2FUNC(void, OS_CODE, tpl_ipdu_pack_func)(void);
+
+/*
+ * Prototype of the bulk unpack functions. They are generated by goil
+ * for each received IPDU and unpack a whole frame into the value of
+ * all the network messages of the IPDU.
+ */
+typedef P2FUNC(void, OS_CODE, tpl_ipdu_unpack_func)(
+  CONSTP2CONST(uint8, AUTOMATIC, COM_VAR) frame);
 
 /*
  * A tpl_sending_ipdu gathers :
  * - An id
  * - A mode
- * - A 8 bytes buffer pointer
- */ 
+ * - A buffer pointer
+ * - The size of the buffer
+ * - The pack function of the IPDU
+ */
 struct TPL_SENDING_IPDU {
-  CONST(tpl_ipdu_id, TYPEDEF)      id;
-  CONST(tpl_ipdu_mode, TYPEDEF)    mode;
-  CONSTP2VAR(u8, TYPEDEF, COM_VAR) buffer;
+  CONST(tpl_ipdu_id, TYPEDEF)         id;
+  CONST(tpl_ipdu_mode, TYPEDEF)       mode;
+  CONSTP2VAR(uint8, TYPEDEF, COM_VAR) buffer;
+  CONST(tpl_ipdu_size, TYPEDEF)       size;
+  CONST(tpl_ipdu_pack_func, TYPEDEF)  pack;
 };
 
 typedef struct TPL_SENDING_IPDU tpl_sending_ipdu;
 
+/*
+ * A tpl_receiving_ipdu gathers :
+ * - An id
+ * - The size of the IPDU
+ * - The unpack function of the IPDU
+ */
+struct TPL_RECEIVING_IPDU {
+  CONST(tpl_ipdu_id, TYPEDEF)           id;
+  CONST(tpl_ipdu_size, TYPEDEF)         size;
+  CONST(tpl_ipdu_unpack_func, TYPEDEF)  unpack;
+};
+
+typedef struct TPL_RECEIVING_IPDU tpl_receiving_ipdu;
+
+#if RECEIVE_IPDU_COUNT > 0
+/*
+ * Table of receiving IPDU pointers
+ */
+#define OS_START_SEC_CONST_UNSPECIFIED
+#include "tpl_memmap.h"
+extern CONSTP2CONST(tpl_receiving_ipdu, AUTOMATIC, OS_CONST)
+  tpl_receiving_ipdu_table[RECEIVE_IPDU_COUNT];
+#define OS_STOP_SEC_CONST_UNSPECIFIED
+#include "tpl_memmap.h"
+#endif
+
+#define OS_START_SEC_CODE
+#include "tpl_memmap.h"
+
+/*
+ * tpl_receive_ipdu is called by the lower layer (typically the ISR of
+ * the CAN controller) when a frame is received for an IPDU. All the
+ * network messages of the IPDU are unpacked in one pass and the external
+ * receiving message objects attached to them get their new value.
+ */
+FUNC(tpl_status, OS_CODE) tpl_receive_ipdu(
+  CONST(tpl_ipdu_id, AUTOMATIC)           ipdu_id,
+  CONSTP2CONST(uint8, AUTOMATIC, COM_VAR) frame,
+  CONST(tpl_ipdu_size, AUTOMATIC)         length);
+
+#define OS_STOP_SEC_CODE
+#include "tpl_memmap.h"
+
 /*  __TPL_COM_IPDU_H__  */
-#endif
\ No newline at end of file
+#endif
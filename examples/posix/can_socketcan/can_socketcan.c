@@ -0,0 +1,104 @@
+/**
+ * @file can_socketcan.c
+ *
+ * @section desc File description
+ *
+ * Echo all the frames received on the vcan0 SocketCAN interface with the
+ * CAN ID incremented by one. The frames are received by an ISR2 and sent
+ * back by batches.
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline OS
+ *
+ * Trampoline is copyright (c) IRCCyN 2005+
+ * Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the Lesser GNU Public Licence
+ *
+ *  @section infos File informations
+ *
+ *  $Date$
+ *  $Rev$
+ *  $Author$
+ *  $URL$
+ */
+#include <Can.h>
+#include <CanIf.h>
+#include <signal.h>
+#include <stdio.h>
+#include <tpl_can_socketcan_driver.h>
+#include <tpl_os.h>
+
+// The reception on vcan0 raises SIGIO, which is the source of the can_rx ISR
+TPL_CAN_SOCKETCAN_CONTROLLER(vcan0_controller, "vcan0", SIGIO);
+
+static uint8 payloads[TPL_CAN_SOCKETCAN_BATCH_SIZE][TPL_CAN_FD_FRAME_MAXIMUM_PAYLOAD_SIZE];
+static Can_PduType frames[TPL_CAN_SOCKETCAN_BATCH_SIZE];
+static unsigned long received_count;
+
+int main(void)
+{
+	static tpl_can_controller_config_t can_controllers_config[] =
+	{
+		// The baud rate is set with "ip link", only the CAN-FD support matters here
+		{
+			&vcan0_controller,
+			{
+				.CanControllerBaudRate = 500,
+				.CanControllerBaudRateConfigID = 0,
+				.use_fd_configuration = TRUE,
+				{
+					.CanControllerFdBaudRate = 2000,
+					.CanControllerTxBitRateSwitch = FALSE
+				},
+			},
+		}
+	};
+	static Can_ConfigType can_config_type =
+	{
+		can_controllers_config,
+		sizeof(can_controllers_config) / sizeof(can_controllers_config[0])
+	};
+	int ret;
+	int i;
+
+	for (i = 0; i < TPL_CAN_SOCKETCAN_BATCH_SIZE; i++)
+		frames[i].sdu = payloads[i];
+
+	ret = Can_Init(&can_config_type);
+	if (ret)
+	{
+		printf("[%s:%d] Error : Can_Init() failed (%d).\r\n", __func__, __LINE__, ret);
+		return -1;
+	}
+
+	printf("Echoing the frames received on vcan0. Press 'q' to exit.\r\n");
+	StartOS(OSDEFAULTAPPMODE);
+	return 0;
+}
+
+ISR(can_rx)
+{
+	PduInfoType pdu_info;
+	unsigned int count = 0;
+
+	// Drain the controller, the frames are read from the socket by batches
+	do
+	{
+		pdu_info.SduDataPtr = (uint8 *) &frames[count];
+		if (CanIf_ReadRxPduData(0, &pdu_info) != E_OK)
+			break;
+		frames[count].id++;
+		count++;
+
+		// Send back the frames once the batch is full or the controller empty
+		if ((count == TPL_CAN_SOCKETCAN_BATCH_SIZE) || !tpl_can_socketcan_is_data_available(&vcan0_controller))
+		{
+			received_count += count;
+			if (tpl_can_socketcan_transmit_batch(&vcan0_controller, frames, count) != count)
+				printf("[%s:%d] Error : the transmit queue is full.\r\n", __func__, __LINE__);
+			count = 0;
+		}
+	} while (1);
+}
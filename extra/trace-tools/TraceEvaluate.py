@@ -103,6 +103,26 @@ class TraceEvaluate:
                 iocName = self.staticInfo.iocNames[i]
                 evType = rawType+'_'+kind
                 event = {'ts':ts, 'type':evType, 'id':i, 'iocName':iocName}     
+            elif rawType == 'schedule': #deferred reschedule from ISR2
+                kind = rawEvent['kind']
+                evType = rawType+'_'+kind
+                if kind == 'deferred':
+                    i = int(rawEvent['proc_id'])
+                    procName = self.staticInfo.procNames[i]
+                    event = {'ts':ts,'type':evType, 'id':i, 'procName':procName}
+                elif kind == 'coalesced':
+                    count = int(rawEvent['count'])
+                    event = {'ts':ts,'type':evType, 'count':count}
+                else:
+                    print('ERROR unhandled schedule kind: {0}'.format(rawEvent['kind']))
+                    event = {'ts':ts,'type':'trace','info':evType}
+            elif rawType == 'service_stats': #service durations, sent by ShutdownOS
+                event = {'ts':ts,'type':rawType,
+                         'serviceId':int(rawEvent['service_id']),
+                         'count':int(rawEvent['count']),
+                         'min':int(rawEvent['min']),
+                         'max':int(rawEvent['max']),
+                         'histogram':rawEvent['histogram']}
             elif rawType == 'overflow': #overflow
                 event = {'ts':ts,'type':rawType}
             elif rawType == 'trace': #communication pb with trace (serial,…)
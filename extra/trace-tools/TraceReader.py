@@ -15,7 +15,7 @@ class TraceReader:
     '''
     def __init__(self):
         # trace event ids
-        self.eventType = ['overflow','proc','resource','event','timeobj','message','ioc']
+        self.eventType = ['overflow','proc','resource','event','timeobj','message','ioc','schedule']
 
     def getEvent(self):
         ''' Generator that sends raw events one by one to the main thread'''
@@ -98,6 +98,14 @@ class TraceReader:
                 evt['kind'] = 'receive'
             else :
                 print('ERROR, invalid message type: '+str(evtBin[3]))
+        elif evt['type'] == 'schedule':
+            kind = evtBin[0] & 0x1 #0 deferred, 1 coalesced
+            if (kind == 0 ) :   # SCHEDULE_DEFERRED
+                evt['kind'] = 'deferred'
+                evt['proc_id'] = evtBin[3]
+            else:               # SCHEDULE_COALESCED
+                evt['kind'] = 'coalesced'
+                evt['count'] = evtBin[3]
         elif evt['type'] == 'overflow':
             pass
         else:
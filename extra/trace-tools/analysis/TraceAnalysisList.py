@@ -23,6 +23,9 @@ class TraceAnalysisList(TraceAnalysis.TraceAnalysis):
                 'message_receive':self.handleEventMessageReceive,
                 'ioc_send':self.handleEventSendIoc, 
                 'ioc_receive': self.handleEventReceiveIoc, 
+                'schedule_deferred': self.handleEventScheduleDeferred,
+                'schedule_coalesced': self.handleEventScheduleCoalesced,
+                'service_stats': self.handleEventServiceStats,
                 'overflow': self.handleEventOverflow, 
                 'trace': self.handleEventTrace}
 
@@ -90,6 +93,27 @@ class TraceAnalysisList(TraceAnalysis.TraceAnalysis):
         kind = ev['kind']
         print('msg  received: {0}'.format(ev['msgName']))
 
+    def handleEventScheduleDeferred(self,ev):
+        ''' called by the evaluator when an ISR2 skips a reschedule.'''
+        self.timeStamp(ev)
+        print('isr  {0: <20} defers the reschedule'.format(ev['procName']))
+
+    def handleEventScheduleCoalesced(self,ev):
+        ''' called by the evaluator when the election ending an ISR2 burst is done.'''
+        self.timeStamp(ev)
+        print('{0} deferred reschedules coalesced in one election'.format(ev['count']))
+
+    def handleEventServiceStats(self,ev):
+        ''' called by the evaluator for the durations of a service (in cycles).
+            Bucket i of the histogram counts the durations in [2^i, 2^(i+1)[.'''
+        self.timeStamp(ev)
+        print('service {0:>3} called {1} times, min {2}, max {3}, histogram {4}'.format(
+                ev['serviceId'],
+                ev['count'],
+                ev['min'],
+                ev['max'],
+                ev['histogram']))
+
     def handleEventOverflow(self,ev):
         ''' called by the evaluator when there is an overflow (i.e. communication is too slow)'''
         print('*** ERROR, OVERFLOW : some messages may have been deleted ***')
@@ -124,6 +124,16 @@ void C_BoolCommandLineOption::printBoolOptions (void) {
 
 //--------------------------------------------------------------------------------------------------
 
+void C_BoolCommandLineOption::resetToDefaultValues (void) {
+  C_BoolCommandLineOption * p = gFirstBoolCommand ;
+  while (p != nullptr) {
+    p->mValue = false ;
+    p = p->mNext ;
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+
 void C_BoolCommandLineOption::getBoolOptionNameList (TC_UniqueArray <String> & outArray) {
   C_BoolCommandLineOption * p = gFirstBoolCommand ;
   while (p != nullptr) {
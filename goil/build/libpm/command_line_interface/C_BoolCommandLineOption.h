@@ -56,6 +56,7 @@ class C_BoolCommandLineOption final : public C_CommandLineOption {
                                                      bool & outCocoaOutput) ;
   public: static void printUsageOfBoolOptions (void) ;
   public: static void printBoolOptions (void) ;
+  public: static void resetToDefaultValues (void) ;
 
 //--- Option introspection
   public: static void getBoolOptionNameList (TC_UniqueArray <String> & outArray) ;
@@ -155,6 +155,16 @@ void C_StringCommandLineOption::printStringOptions (void) {
 
 //--------------------------------------------------------------------------------------------------
 
+void C_StringCommandLineOption::resetToDefaultValues (void) {
+  C_StringCommandLineOption * p = gFirstStringOption ;
+  while (p != nullptr) {
+    p->mValue = p->mDefaultValue ;
+    p = p->mNext ;
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+
 void C_StringCommandLineOption::releaseStrings (void) {
   C_StringCommandLineOption * p = gFirstStringOption ;
   while (p != nullptr) {
@@ -56,6 +56,7 @@ class C_StringCommandLineOption final : public C_CommandLineOption {
 
   public: static void printUsageOfStringOptions (void) ;
   public: static void printStringOptions (void) ;
+  public: static void resetToDefaultValues (void) ;
 
   public: static void releaseStrings (void) ; // Called at the end of main routine
 
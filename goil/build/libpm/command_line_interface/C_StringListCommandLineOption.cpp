@@ -159,6 +159,16 @@ void C_StringListCommandLineOption::printStringOptions (void) {
 
 //--------------------------------------------------------------------------------------------------
 
+void C_StringListCommandLineOption::resetToDefaultValues (void) {
+  C_StringListCommandLineOption * p = gFirstStringListOption ;
+  while (p != nullptr) {
+    p->mValue.free () ;
+    p = p->mNext ;
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+
 void C_StringListCommandLineOption::releaseStrings (void) {
   C_StringListCommandLineOption * p = gFirstStringListOption ;
   while (p != nullptr) {
@@ -53,6 +53,7 @@ class C_StringListCommandLineOption final : public C_CommandLineOption {
                                                            bool & outCommandLineOptionStringIsValid)  ;
   public: static void printUsageOfStringOptions (void) ;
   public: static void printStringOptions (void) ;
+  public: static void resetToDefaultValues (void) ;
 
   public: static void releaseStrings (void) ; // Called at the end of main routine
 
@@ -171,6 +171,16 @@ void C_UIntCommandLineOption::printUIntOptions (void) {
 
 //--------------------------------------------------------------------------------------------------
 
+void C_UIntCommandLineOption::resetToDefaultValues (void) {
+  C_UIntCommandLineOption * p = gFirstIntOption ;
+  while (p != nullptr) {
+    p->mValue = p->mDefaultValue ;
+    p = p->mNext ;
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+
 void C_UIntCommandLineOption::getUIntOptionNameList (TC_UniqueArray <String> & outArray) {
   C_UIntCommandLineOption * p = gFirstIntOption ;
   while (p != nullptr) {
@@ -55,6 +55,7 @@ class C_UIntCommandLineOption final : public C_CommandLineOption {
                                                      bool & outCommandLineOptionStringIsValid)  ;
   public: static void printUsageOfUIntOptions (void) ;
   public: static void printUIntOptions (void) ;
+  public: static void resetToDefaultValues (void) ;
 
 //--- Option introspection
   public: static void getUIntOptionNameList (TC_UniqueArray <String> & outArray) ;
@@ -60,6 +60,19 @@ bool cocoaOutput (void) {
 
 //--------------------------------------------------------------------------------------------------
 
+void resetCommandLineOptions (void) {
+  C_BoolCommandLineOption::resetToDefaultValues () ;
+  C_UIntCommandLineOption::resetToDefaultValues () ;
+  C_StringCommandLineOption::resetToDefaultValues () ;
+  C_StringListCommandLineOption::resetToDefaultValues () ;
+  gCocoaOutput = false ;
+  #if COMPILE_FOR_WINDOWS == 0
+    C_ColoredConsole::setUseTextAttributes (true) ;
+  #endif
+}
+
+//--------------------------------------------------------------------------------------------------
+
 const char * galgasVersionString (void) {
   return "3.7.0" ;
 }
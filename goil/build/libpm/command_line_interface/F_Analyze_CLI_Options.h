@@ -38,6 +38,13 @@ void F_Analyze_CLI_Options (const int argv,
                             const char* * inHelpMessages,
                             void print_tool_help_message (void)) ;
 
+//--------------------------------------------------------------------------------------------------
+//  Restore the options to their default values, before analyzing the command line of another
+//  command run by the same process (a server)
+//--------------------------------------------------------------------------------------------------
+
+void resetCommandLineOptions (void) ;
+
 //--------------------------------------------------------------------------------------------------
 
 const char * projectVersionString (void) ;
@@ -50,6 +57,8 @@ uint32_t commandLineArgumentCount (void) ;
 
 String commandLineArgumentAtIndex (const uint32_t inIndex) ;
 
+void setCommandLineArguments (const int inArgc, const char * inArgv []) ;
+
 //--------------------------------------------------------------------------------------------------
 
 bool cocoaOutput (void) ;
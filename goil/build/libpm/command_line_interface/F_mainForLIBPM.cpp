@@ -24,6 +24,7 @@
 #include "F_DisplayException.h"
 #include "C_ConsoleOut.h"
 #include "DateTime.h"
+#include "FileManager.h"
 #include "SharedObject.h"
 #include "cpp-allocation.h"
 #include "basic-allocation.h"
@@ -31,10 +32,14 @@
 #include "F_Analyze_CLI_Options.h"
 #include "unicode_character_base.h"
 #include "acStrongPtr_class.h"
+#include "CommandServer.h"
 
 //--------------------------------------------------------------------------------------------------
 
+#include <ctype.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 //--------------------------------------------------------------------------------------------------
 
@@ -59,16 +64,101 @@ String commandLineArgumentAtIndex (const uint32_t inIndex) {
 
 //--------------------------------------------------------------------------------------------------
 
+void setCommandLineArguments (const int inArgc, const char * inArgv []) {
+  gArgc = (uint32_t) inArgc ;
+  gArgv = inArgv ;
+}
+
+//--------------------------------------------------------------------------------------------------
+//  Files enqueued for writing after the last source file has been handled (see
+//  Compiler::reportEnqueuedFileWrites)
+//--------------------------------------------------------------------------------------------------
+
+static bool allEnqueuedFilesWritten (void) {
+  TC_UniqueArray <String> filePathes ;
+  TC_UniqueArray <FileManager::EnqueuedWriteResult> results ;
+  FileManager::waitForEnqueuedWrites (filePathes, results) ;
+  bool ok = true ;
+  for (int32_t i=0 ; i<results.count () ; i++) {
+    if (results (i COMMA_HERE) == FileManager::EnqueuedWriteResult::failed) {
+      gCout.appendCString ("*** Error: cannot write '") ;
+      gCout.appendString (filePathes (i COMMA_HERE)) ;
+      gCout.appendCString ("' file ***\n") ;
+      ok = false ;
+    }
+  }
+  return ok ;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+static int runMainRoutine (int inArgc, const char * inArgv []) {
+  int returnCode = mainForLIBPM (inArgc, inArgv) ;
+  if (! allEnqueuedFilesWritten ()) {
+    returnCode = 1 ; // Error code
+  }
+  return returnCode ;
+}
+
+//--------------------------------------------------------------------------------------------------
+//  Server mode (see CommandServer): with the --serve=<socket> option, the tool serves the commands
+//  sent to the socket. Otherwise, the command is sent to the server whose socket is named by the
+//  <TOOL>_SERVER environment variable (GOIL_SERVER for goil and goil-debug), and is run by the
+//  tool itself if there is no such server.
+//--------------------------------------------------------------------------------------------------
+
+static String serveOptionValue (const int inArgc, const char * inArgv []) {
+  String result ;
+  for (int i=1 ; i<inArgc ; i++) {
+    if (strncmp (inArgv [i], "--serve=", 8) == 0) {
+      result = inArgv [i] + 8 ;
+    }
+  }
+  return result ;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+static String serverEnvironmentVariableName (const char * inToolPath) {
+  const String toolName = String (inToolPath).lastPathComponent () ;
+  String result ;
+  const char * p = toolName.cString () ;
+  while (isalnum ((unsigned char) * p)) {
+    result.appendChar (TO_UNICODE (uint32_t (* p))) ;
+    p ++ ;
+  }
+  result = result.uppercaseString () ;
+  result.appendCString ("_SERVER") ;
+  return result ;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+static int runOrServeCommands (const int inArgc, const char * inArgv []) {
+  int returnCode = 0 ;
+  const String socketPath = serveOptionValue (inArgc, inArgv) ;
+  if (socketPath.length () > 0) {
+    returnCode = CommandServer::serve (socketPath, runMainRoutine) ;
+  }else{
+    const char * serverSocketPath = ::getenv (serverEnvironmentVariableName (inArgv [0]).cString ()) ;
+    if (! CommandServer::forwardCommand (serverSocketPath, inArgc, inArgv, returnCode)) {
+      returnCode = runMainRoutine (inArgc, inArgv) ;
+    }
+  }
+  return returnCode ;
+}
+
+//--------------------------------------------------------------------------------------------------
+
 int main (int argc, const char * argv []) {
-  gArgc = (uint32_t) argc ;
-  gArgv = argv ;
+  setCommandLineArguments (argc, argv) ;
   DateTime::enterCurrentToolModificationTime (argv [0]) ;
   int returnCode = 0 ; // No error
 //---
   if (returnCode == 0) {
     try{
       PrologueEpilogue::runPrologueActions () ;
-      returnCode = mainForLIBPM (argc, argv) ;
+      returnCode = runOrServeCommands (argc, argv) ;
       PrologueEpilogue::runEpilogueActions () ;
       C_BDD::freeBDDStataStructures () ;
       #ifndef DO_NOT_GENERATE_CHECKINGS
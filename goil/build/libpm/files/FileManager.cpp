@@ -32,6 +32,17 @@
 
 //--------------------------------------------------------------------------------------------------
 
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+//--------------------------------------------------------------------------------------------------
+
 #ifndef COMPILE_FOR_WINDOWS
   #error COMPILE_FOR_WINDOWS is undefined
 #endif
@@ -163,10 +174,17 @@ FILE * FileManager::openBinaryFileForReading (const String & inFilePath) {
   #pragma mark Read binary file at once
 #endif
 
+//--------------------------------------------------------------------------------------------------
+//  A file enqueued for writing is written before it is read or tested (see enqueueStringWrite)
+//--------------------------------------------------------------------------------------------------
+
+static void waitForPendingWriteOfFile (const String & inFilePath) ;
+
 //--------------------------------------------------------------------------------------------------
 
 bool FileManager::binaryDataWithContentOfFile (const String & inFilePath,
                                                U8Data & outBinaryData) {
+  waitForPendingWriteOfFile (inFilePath) ;
   outBinaryData.free () ;
 //--- Open file for binary reading
   const String nativePath = nativePathWithUnixPath (inFilePath) ;
@@ -568,6 +586,7 @@ static void parseASCIIWithReplacementCharacter (const U8Data & inDataString,
 String FileManager::stringWithContentOfFile (const String & inFilePath,
                                              PMTextFileEncoding & outTextFileEncoding,
                                              bool & outOk) {
+  waitForPendingWriteOfFile (inFilePath) ;
   #ifdef PRINT_SNIFF_ENCODING
     printf ("** SNIFF ENCODING for '%s': ", inFilePath.cString ()) ;
   #endif
@@ -625,6 +644,7 @@ String FileManager::stringWithContentOfFile (const String & inFilePath) {
 
 bool FileManager::writeStringToFile (const String & inString,
                                        const String & inFilePath) {
+  waitForPendingWriteOfFile (inFilePath) ;
   makeDirectoryIfDoesNotExist (inFilePath.stringByDeletingLastPathComponent ()) ;
   TextFileWrite file (inFilePath) ;
   bool success = file.isOpened () ;
@@ -639,6 +659,7 @@ bool FileManager::writeStringToFile (const String & inString,
 
 bool FileManager::writeStringToExecutableFile (const String & inString,
                                                  const String & inFilePath) {
+  waitForPendingWriteOfFile (inFilePath) ;
   makeDirectoryIfDoesNotExist (inFilePath.stringByDeletingLastPathComponent()) ;
   TextFileWrite file (inFilePath) ;
   file.appendString (inString) ;
@@ -654,6 +675,236 @@ bool FileManager::writeStringToExecutableFile (const String & inString,
   return success ;
 }
 
+//--------------------------------------------------------------------------------------------------
+//
+//   Concurrent file writing
+//
+//  Worker threads only see plain std::string values: String and the memory control functions are
+//  used from the main thread only.
+//
+//--------------------------------------------------------------------------------------------------
+
+class cFileWriteJob final {
+  public: std::string mFilePath ;
+  public: std::string mNativeFilePath ;
+  public: std::string mContents ;
+  public: bool mExecutable ;
+  public: FileManager::EnqueuedWriteResult mResult ;
+
+  public: cFileWriteJob (const std::string & inFilePath,
+                         const std::string & inNativeFilePath,
+                         const std::string & inContents,
+                         const bool inExecutable) :
+  mFilePath (inFilePath),
+  mNativeFilePath (inNativeFilePath),
+  mContents (inContents),
+  mExecutable (inExecutable),
+  mResult (FileManager::EnqueuedWriteResult::failed) {
+  }
+} ;
+
+//--------------------------------------------------------------------------------------------------
+
+static FileManager::EnqueuedWriteResult performFileWriteJob (const cFileWriteJob & inJob) {
+  struct stat fileStat ;
+  const bool fileAlreadyExists = ::stat (inJob.mNativeFilePath.c_str (), & fileStat) == 0 ;
+  FILE * f = ::fopen (inJob.mNativeFilePath.c_str (), "wt") ;
+  bool success = f != nullptr ;
+  if (success) {
+    const size_t written = ::fwrite (inJob.mContents.data (), 1, inJob.mContents.size (), f) ;
+    success = (::fclose (f) == 0) && (written == inJob.mContents.size ()) ;
+  }
+  #if COMPILE_FOR_WINDOWS == 0
+    if (success && inJob.mExecutable) {
+      ::stat (inJob.mNativeFilePath.c_str (), & fileStat) ;
+      ::chmod (inJob.mNativeFilePath.c_str (), fileStat.st_mode | S_IXUSR | S_IXGRP | S_IXOTH) ;
+    }
+  #endif
+  if (! success) {
+    return FileManager::EnqueuedWriteResult::failed ;
+  }else if (fileAlreadyExists) {
+    return FileManager::EnqueuedWriteResult::replaced ;
+  }else{
+    return FileManager::EnqueuedWriteResult::created ;
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+
+class cFileWriterPool final {
+  private: std::mutex mMutex ;
+  private: std::condition_variable mJobAvailable ;
+  private: std::condition_variable mAllJobsDone ;
+//--- Jobs enqueued since the last drain; std::deque keeps references valid on push_back
+  private: std::deque <cFileWriteJob> mJobs ;
+  private: std::set <std::string> mPendingFilePathes ;
+//--- Results of the drained jobs, in enqueue order, until they are retrieved
+  private: std::vector <std::pair <std::string, FileManager::EnqueuedWriteResult> > mResults ;
+//--- Written files and time spent writing them by the workers, until they are retrieved
+  private: uint32_t mWrittenFileCount ;
+  private: uint64_t mWriteMicroseconds ;
+  private: size_t mNextJobIndex ;
+  private: size_t mCompletedJobCount ;
+  private: std::vector <std::thread> mWorkers ;
+  private: bool mStop ;
+
+  public: cFileWriterPool (void) :
+  mMutex (),
+  mJobAvailable (),
+  mAllJobsDone (),
+  mJobs (),
+  mPendingFilePathes (),
+  mResults (),
+  mWrittenFileCount (0),
+  mWriteMicroseconds (0),
+  mNextJobIndex (0),
+  mCompletedJobCount (0),
+  mWorkers (),
+  mStop (false) {
+  }
+
+  public: ~ cFileWriterPool (void) {
+    {
+      const std::lock_guard <std::mutex> lock (mMutex) ;
+      mStop = true ;
+    }
+    mJobAvailable.notify_all () ;
+    for (size_t i=0 ; i<mWorkers.size () ; i++) {
+      mWorkers [i].join () ;
+    }
+  }
+
+  public: void enqueue (const std::string & inFilePath,
+                        const std::string & inNativeFilePath,
+                        const std::string & inContents,
+                        const bool inExecutable) {
+    std::unique_lock <std::mutex> lock (mMutex) ;
+  //--- A file that is still pending is written before it is enqueued again
+    if (mPendingFilePathes.count (inFilePath) > 0) {
+      drain (lock) ;
+    }
+    if (mWorkers.size () == 0) {
+      size_t workerCount = std::thread::hardware_concurrency () ;
+      if (workerCount == 0) {
+        workerCount = 1 ;
+      }else if (workerCount > 8) {
+        workerCount = 8 ;
+      }
+      for (size_t i=0 ; i<workerCount ; i++) {
+        mWorkers.push_back (std::thread (& cFileWriterPool::workerLoop, this)) ;
+      }
+    }
+    mJobs.push_back (cFileWriteJob (inFilePath, inNativeFilePath, inContents, inExecutable)) ;
+    mPendingFilePathes.insert (inFilePath) ;
+    lock.unlock () ;
+    mJobAvailable.notify_one () ;
+  }
+
+  public: void waitForFile (const std::string & inFilePath) {
+    std::unique_lock <std::mutex> lock (mMutex) ;
+    if (mPendingFilePathes.count (inFilePath) > 0) {
+      drain (lock) ;
+    }
+  }
+
+  public: void waitForAllJobs (std::vector <std::pair <std::string, FileManager::EnqueuedWriteResult> > & outResults) {
+    std::unique_lock <std::mutex> lock (mMutex) ;
+    drain (lock) ;
+    outResults.swap (mResults) ;
+    mResults.clear () ;
+  }
+
+  public: void takeWriteTime (uint32_t & outFileCount, uint64_t & outMicroseconds) {
+    const std::lock_guard <std::mutex> lock (mMutex) ;
+    outFileCount = mWrittenFileCount ;
+    outMicroseconds = mWriteMicroseconds ;
+    mWrittenFileCount = 0 ;
+    mWriteMicroseconds = 0 ;
+  }
+
+  private: void drain (std::unique_lock <std::mutex> & ioLock) {
+    mAllJobsDone.wait (ioLock, [this] { return mCompletedJobCount == mJobs.size () ; }) ;
+    for (size_t i=0 ; i<mJobs.size () ; i++) {
+      mResults.push_back (std::make_pair (mJobs [i].mFilePath, mJobs [i].mResult)) ;
+    }
+    mJobs.clear () ;
+    mPendingFilePathes.clear () ;
+    mNextJobIndex = 0 ;
+    mCompletedJobCount = 0 ;
+  }
+
+  private: void workerLoop (void) {
+    std::unique_lock <std::mutex> lock (mMutex) ;
+    while (true) {
+      mJobAvailable.wait (lock, [this] { return mStop || (mNextJobIndex < mJobs.size ()) ; }) ;
+      if (mNextJobIndex < mJobs.size ()) {
+        cFileWriteJob & job = mJobs [mNextJobIndex] ;
+        mNextJobIndex += 1 ;
+        lock.unlock () ;
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now () ;
+        const FileManager::EnqueuedWriteResult result = performFileWriteJob (job) ;
+        const uint64_t microseconds = uint64_t (std::chrono::duration_cast <std::chrono::microseconds> (
+          std::chrono::steady_clock::now () - start
+        ).count ()) ;
+        lock.lock () ;
+        job.mResult = result ;
+        mWrittenFileCount += 1 ;
+        mWriteMicroseconds += microseconds ;
+        mCompletedJobCount += 1 ;
+        if (mCompletedJobCount == mJobs.size ()) {
+          mAllJobsDone.notify_all () ;
+        }
+      }else{ // mStop is set and there is nothing left to write
+        return ;
+      }
+    }
+  }
+
+//--- No copy
+  private: cFileWriterPool (const cFileWriterPool &) = delete ;
+  private: cFileWriterPool & operator = (const cFileWriterPool &) = delete ;
+} ;
+
+//--------------------------------------------------------------------------------------------------
+
+static cFileWriterPool gFileWriterPool ;
+
+//--------------------------------------------------------------------------------------------------
+
+void FileManager::enqueueStringWrite (const String & inString,
+                                      const String & inFilePath,
+                                      const bool inExecutable) {
+  makeDirectoryIfDoesNotExist (inFilePath.stringByDeletingLastPathComponent ()) ;
+  gFileWriterPool.enqueue (inFilePath.cString (),
+                           nativePathWithUnixPath (inFilePath).cString (),
+                           inString.cString (),
+                           inExecutable) ;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+static void waitForPendingWriteOfFile (const String & inFilePath) {
+  gFileWriterPool.waitForFile (inFilePath.cString ()) ;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void FileManager::waitForEnqueuedWrites (TC_UniqueArray <String> & outFilePathes,
+                                         TC_UniqueArray <EnqueuedWriteResult> & outResults) {
+  std::vector <std::pair <std::string, EnqueuedWriteResult> > results ;
+  gFileWriterPool.waitForAllJobs (results) ;
+  for (size_t i=0 ; i<results.size () ; i++) {
+    outFilePathes.appendObject (String (results [i].first.c_str ())) ;
+    outResults.appendObject (results [i].second) ;
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void FileManager::takeEnqueuedWriteTime (uint32_t & outFileCount, uint64_t & outMicroseconds) {
+  gFileWriterPool.takeWriteTime (outFileCount, outMicroseconds) ;
+}
+
 //--------------------------------------------------------------------------------------------------
 
 bool FileManager::writeBinaryDataToFile (const U8Data & inBinaryData,
@@ -1167,6 +1418,7 @@ int32_t FileManager::setFilePosixPermissions (const String & inFilePath,
 //--------------------------------------------------------------------------------------------------
 
 bool FileManager::fileExistsAtPath (const String & inFilePath) {
+  waitForPendingWriteOfFile (inFilePath) ;
   const String nativePath = nativePathWithUnixPath (inFilePath) ;
 //--- Get file properties
   bool exists = nativePath.length () > 0 ;
@@ -61,6 +61,23 @@ class FileManager final {
   public: static bool writeStringToExecutableFile (const String & inString,
                                                     const String & inFilePath) ;
 
+//--- Write string to file from a pool of worker threads. enqueueStringWrite creates the
+//    directory and returns at once; a pending file is written before it is read, tested or
+//    written again. waitForEnqueuedWrites blocks until every enqueued file has been written, and
+//    returns the enqueued paths with what has been done, in enqueue order.
+  public: enum class EnqueuedWriteResult { created, replaced, failed } ;
+
+  public: static void enqueueStringWrite (const String & inString,
+                                          const String & inFilePath,
+                                          const bool inExecutable) ;
+
+  public: static void waitForEnqueuedWrites (TC_UniqueArray <String> & outFilePathes,
+                                             TC_UniqueArray <EnqueuedWriteResult> & outResults) ;
+
+//--- Number of enqueued files written, and time the workers have spent writing them, since the
+//    previous call
+  public: static void takeEnqueuedWriteTime (uint32_t & outFileCount, uint64_t & outMicroseconds) ;
+
 //--- Write data to file
   public: static bool writeBinaryDataToFile (const U8Data & inBinaryData,
                                               const String & inFilePath) ;
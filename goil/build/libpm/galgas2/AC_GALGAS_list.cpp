@@ -318,6 +318,9 @@ class cListMapNode {
   public: String mKey ;
   public: capCollectionElementArray myList ;
 
+//--- Allocation by size class (release mode)
+  macroUseSizeClassAllocation
+
 //--- Constructors
   public: cListMapNode (const String & inKey) ;
   public: cListMapNode (const cListMapNode * inNode) ;
@@ -29,6 +29,11 @@
 
 class cMapNode ;
 
+//--------------------------------------------------------------------------------------------------
+//  Below this entry count, a search walks the tree ; from it, a hash index is built
+
+static const uint32_t kHashIndexMinimumCount = 32 ;
+
 //--------------------------------------------------------------------------------------------------
 //
 //  c S h a r e d M a p R o o t
@@ -41,6 +46,12 @@ class cSharedMapRoot : public SharedObject {
   private: uint32_t mCount ;
   protected: cSharedMapRoot * mOverridenMap ;
 
+//--------------------------------- Hash index (open addressing, linear probing) of the nodes of mRoot;
+//  built on the first search once the map has kHashIndexMinimumCount entries, the tree still gives
+//  the enumeration order. An empty array means no index.
+  private: mutable TC_UniqueArray <cMapNode *> mHashIndex ;
+  private: mutable uint32_t mHashIndexNodeCount ;
+
 //--------------------------------- Accessors
   public: inline const cMapNode * root (void) const { return mRoot ; }
   public: inline uint32_t count (void) const { return mCount ; }
@@ -74,7 +85,16 @@ class cSharedMapRoot : public SharedObject {
                                                         const char * inShadowErrorMessage
                                                         COMMA_LOCATION_ARGS) ;
 
+//--------------------------------- Hash index
+  private: void buildHashIndex (void) const ;
+  private: void enterNodeInHashIndex (cMapNode * inNode) const ;
+  private: void removeNodeFromHashIndex (const cMapNode * inNode) ;
+  private: void insertedNode (cMapNode * inNode) ;
+
 //--------------------------------- Search
+  private: cMapNode * findEntryInThisMap (const String & inKey,
+                                          const uint32_t inKeyHash) const ;
+
   private: VIRTUAL_IN_DEBUG cMapNode * findEntryInMap (const String & inKey,
                                                         const cSharedMapRoot * inFirstMap) const ;
 
@@ -163,8 +183,12 @@ class cMapNode {
   public: cMapNode * mSupPtr ;
   public: int32_t mBalance ;
   public: const String mKey ;
+  public: const uint32_t mKeyHash ;
   public: capCollectionElement mAttributes ;
 
+//--- Allocation by size class (release mode)
+  macroUseSizeClassAllocation
+
 //--- Constructors
   public: cMapNode (const String & inKey,
                      const capCollectionElement & inAttributes) ;
@@ -185,7 +209,9 @@ cSharedMapRoot::cSharedMapRoot (LOCATION_ARGS) :
 SharedObject (THERE),
 mRoot (nullptr),
 mCount (0),
-mOverridenMap (nullptr) {
+mOverridenMap (nullptr),
+mHashIndex (),
+mHashIndexNodeCount (0) {
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -195,6 +221,9 @@ cSharedMapRoot::~ cSharedMapRoot (void) {
   macroDetachSharedObject (mOverridenMap) ;
 }
 
+//--------------------------------------------------------------------------------------------------
+//  Keys are interned: a name entered in several maps, or several times, is stored once, and
+//  searching with a key of another map compares by pointer
 //--------------------------------------------------------------------------------------------------
 
 cMapNode::cMapNode (const String & inKey,
@@ -202,7 +231,8 @@ cMapNode::cMapNode (const String & inKey,
 mInfPtr (nullptr),
 mSupPtr (nullptr),
 mBalance (0),
-mKey (inKey),
+mKey (inKey.internedString ()),
+mKeyHash (inKey.hashValue ()),
 mAttributes (inAttributes) {
 }
 
@@ -221,6 +251,16 @@ cMapNode::~cMapNode (void) {
 
 //--------------------------------------------------------------------------------------------------
 
+static uint32_t nodeCount (const cMapNode * inNode) {
+  uint32_t result = 0 ;
+  if (nullptr != inNode) {
+    result = 1 + nodeCount (inNode->mInfPtr) + nodeCount (inNode->mSupPtr) ;
+  }
+  return result ;
+}
+
+//--------------------------------------------------------------------------------------------------
+
 #ifndef DO_NOT_GENERATE_CHECKINGS
   static void checkNode (const cMapNode * inNode,
                          uint32_t & ioCount) {
@@ -241,6 +281,10 @@ cMapNode::~cMapNode (void) {
     uint32_t n = 0 ;
     checkNode (mRoot, n) ;
     macroAssertThere (n == mCount, "n (%lld) != mCount (%lld)", n, mCount) ;
+    if (mHashIndex.count () > 0) {
+      const uint32_t nodes = nodeCount (mRoot) ;
+      macroAssertThere (nodes == mHashIndexNodeCount, "nodes (%lld) != mHashIndexNodeCount (%lld)", nodes, mHashIndexNodeCount) ;
+    }
   }
 #endif
 
@@ -373,6 +417,146 @@ void AC_GALGAS_map::description (String & ioString,
   #pragma mark Search in map and overridden maps
 #endif
 
+#ifdef PRAGMA_MARK_ALLOWED
+  #pragma mark Hash index
+#endif
+
+//--------------------------------------------------------------------------------------------------
+
+static void enterSubtreeInHashIndex (cMapNode * inNode,
+                                     TC_UniqueArray <cMapNode *> & ioHashIndex) {
+  if (nullptr != inNode) {
+    const uint32_t mask = uint32_t (ioHashIndex.count ()) - 1 ;
+    uint32_t idx = inNode->mKeyHash & mask ;
+    while (nullptr != ioHashIndex (int32_t (idx) COMMA_HERE)) {
+      idx = (idx + 1) & mask ;
+    }
+    ioHashIndex.setObjectAtIndex (inNode, int32_t (idx) COMMA_HERE) ;
+    enterSubtreeInHashIndex (inNode->mInfPtr, ioHashIndex) ;
+    enterSubtreeInHashIndex (inNode->mSupPtr, ioHashIndex) ;
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+//  The table size is a power of two, at least twice the node count
+
+void cSharedMapRoot::buildHashIndex (void) const {
+  mHashIndexNodeCount = nodeCount (mRoot) ;
+  int32_t size = 64 ;
+  while (uint32_t (size) < (2 * mHashIndexNodeCount)) {
+    size *= 2 ;
+  }
+  mHashIndex.removeAll () ;
+  mHashIndex.appendObjects (size, nullptr) ;
+  enterSubtreeInHashIndex (mRoot, mHashIndex) ;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void cSharedMapRoot::enterNodeInHashIndex (cMapNode * inNode) const {
+  const uint32_t mask = uint32_t (mHashIndex.count ()) - 1 ;
+  uint32_t idx = inNode->mKeyHash & mask ;
+  bool found = false ;
+  while ((nullptr != mHashIndex (int32_t (idx) COMMA_HERE)) && !found) {
+    found = mHashIndex (int32_t (idx) COMMA_HERE) == inNode ;
+    idx = (idx + 1) & mask ;
+  }
+  if (!found) {
+    mHashIndex.setObjectAtIndex (inNode, int32_t (idx) COMMA_HERE) ;
+    mHashIndexNodeCount ++ ;
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+//  Called for the node returned by an insertion (a new node, or an existing node that had no
+//  attribute, that enterNodeInHashIndex finds already entered)
+
+void cSharedMapRoot::insertedNode (cMapNode * inNode) {
+  if (mHashIndex.count () > 0) {
+    if (uint32_t (mHashIndex.count ()) < (2 * (mHashIndexNodeCount + 1))) {
+      buildHashIndex () ; // The node is already in the tree
+    }else{
+      enterNodeInHashIndex (inNode) ;
+    }
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+//  Linear probing removal : the following entries of the cluster are shifted back, so that no
+//  tombstone is needed
+
+void cSharedMapRoot::removeNodeFromHashIndex (const cMapNode * inNode) {
+  if (mHashIndex.count () > 0) {
+    const uint32_t mask = uint32_t (mHashIndex.count ()) - 1 ;
+    uint32_t hole = inNode->mKeyHash & mask ;
+    while ((nullptr != mHashIndex (int32_t (hole) COMMA_HERE)) && (mHashIndex (int32_t (hole) COMMA_HERE) != inNode)) {
+      hole = (hole + 1) & mask ;
+    }
+    if (nullptr != mHashIndex (int32_t (hole) COMMA_HERE)) {
+      mHashIndex.setObjectAtIndex (nullptr, int32_t (hole) COMMA_HERE) ;
+      mHashIndexNodeCount -- ;
+      uint32_t idx = (hole + 1) & mask ;
+      while (nullptr != mHashIndex (int32_t (idx) COMMA_HERE)) {
+        cMapNode * node = mHashIndex (int32_t (idx) COMMA_HERE) ;
+        const uint32_t home = node->mKeyHash & mask ;
+        const bool stays = (hole <= idx)
+          ? ((hole < home) && (home <= idx))
+          : ((hole < home) || (home <= idx)) ;
+        if (!stays) {
+          mHashIndex.setObjectAtIndex (node, int32_t (hole) COMMA_HERE) ;
+          mHashIndex.setObjectAtIndex (nullptr, int32_t (idx) COMMA_HERE) ;
+          hole = idx ;
+        }
+        idx = (idx + 1) & mask ;
+      }
+    }
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+
+#ifdef PRAGMA_MARK_ALLOWED
+  #pragma mark Search
+#endif
+
+//--------------------------------------------------------------------------------------------------
+
+cMapNode * cSharedMapRoot::findEntryInThisMap (const String & inKey,
+                                               const uint32_t inKeyHash) const {
+  cMapNode * result = nullptr ;
+  if ((mHashIndex.count () == 0) && (mCount >= kHashIndexMinimumCount)) {
+    buildHashIndex () ;
+  }
+  if (mHashIndex.count () > 0) {
+    const uint32_t mask = uint32_t (mHashIndex.count ()) - 1 ;
+    uint32_t idx = inKeyHash & mask ;
+    cMapNode * node = mHashIndex (int32_t (idx) COMMA_HERE) ;
+    while ((nullptr != node) && (nullptr == result)) {
+      macroValidPointer (node) ;
+      if ((node->mKeyHash == inKeyHash) && (node->mKey == inKey)) {
+        result = node ;
+      }else{
+        idx = (idx + 1) & mask ;
+        node = mHashIndex (int32_t (idx) COMMA_HERE) ;
+      }
+    }
+  }else{
+    cMapNode * currentNode = mRoot ;
+    while ((currentNode != nullptr) && (nullptr == result)) {
+      macroValidPointer (currentNode) ;
+      const int32_t comparaison = currentNode->mKey.compare (inKey) ;
+      if (comparaison > 0) {
+        currentNode = currentNode->mInfPtr ;
+      }else if (comparaison < 0) {
+        currentNode = currentNode->mSupPtr ;
+      }else{ // Found
+        result = currentNode ;
+      }
+    }
+  }
+  return result ;
+}
+
 //--------------------------------------------------------------------------------------------------
 
 cMapNode * cSharedMapRoot::findEntryInMapAtLevel (const String & inKey,
@@ -381,20 +565,9 @@ cMapNode * cSharedMapRoot::findEntryInMapAtLevel (const String & inKey,
   cMapNode * result = nullptr ;
   const cSharedMapRoot * currentMap = inFirstMap ;
   uint32_t level = 0 ;
-  while ((nullptr != currentMap) && (nullptr == result)) {
+  while ((nullptr != currentMap) && (nullptr == result) && (level <= inLevel)) {
     if (inLevel == level) {
-      cMapNode * currentNode = currentMap->mRoot ;
-      while ((currentNode != nullptr) && (nullptr == result)) {
-        macroValidPointer (currentNode) ;
-        const int32_t comparaison = currentNode->mKey.compare (inKey) ;
-        if (comparaison > 0) {
-          currentNode = currentNode->mInfPtr ;
-        }else if (comparaison < 0) {
-          currentNode = currentNode->mSupPtr ;
-        }else{ // Found
-          result = currentNode ;
-        }
-      }
+      result = currentMap->findEntryInThisMap (inKey, inKey.hashValue ()) ;
     }
     level ++ ;
     currentMap = currentMap->mOverridenMap ;
@@ -407,20 +580,10 @@ cMapNode * cSharedMapRoot::findEntryInMapAtLevel (const String & inKey,
 cMapNode * cSharedMapRoot::findEntryInMap (const String & inKey,
                                            const cSharedMapRoot * inFirstMap) const {
   cMapNode * result = nullptr ;
+  const uint32_t keyHash = inKey.hashValue () ;
   const cSharedMapRoot * currentMap = inFirstMap ;
   while ((nullptr != currentMap) && (nullptr == result)) {
-    cMapNode * currentNode = currentMap->mRoot ;
-    while ((currentNode != nullptr) && (nullptr == result)) {
-      macroValidPointer (currentNode) ;
-      const int32_t comparaison = currentNode->mKey.compare (inKey) ;
-      if (comparaison > 0) {
-        currentNode = currentNode->mInfPtr ;
-      }else if (comparaison < 0) {
-        currentNode = currentNode->mSupPtr ;
-      }else{ // Found
-        result = currentNode ;
-      }
-    }
+    result = currentMap->findEntryInThisMap (inKey, keyHash) ;
     currentMap = currentMap->mOverridenMap ;
   }
   return result ;
@@ -546,20 +709,20 @@ static void rotateRight (cMapNode * & ioRootPtr) {
 
 //--------------------------------------------------------------------------------------------------
 
-static bool internalInsertOrReplace (cMapNode * & ioRootPtr,
-                                     const String & inKey,
-                                     const capCollectionElement & ioAttributeArray,
-                                     bool & ioExtension) {
-  bool anObjectHasBeenAdded = false ;
+static cMapNode * internalInsertOrReplace (cMapNode * & ioRootPtr,
+                                          const String & inKey,
+                                          const capCollectionElement & ioAttributeArray,
+                                          bool & ioExtension) {
+  cMapNode * addedNode = nullptr ;
   if (ioRootPtr == nullptr) {
     macroMyNew (ioRootPtr, cMapNode (inKey, ioAttributeArray)) ;
     ioExtension = true ;
-    anObjectHasBeenAdded = true ;
+    addedNode = ioRootPtr ;
   }else{
     macroValidPointer (ioRootPtr) ;
     const int32_t comparaison = ioRootPtr->mKey.compare (inKey) ;
     if (comparaison > 0) {
-      anObjectHasBeenAdded = internalInsertOrReplace (ioRootPtr->mInfPtr, inKey, ioAttributeArray, ioExtension) ;
+      addedNode = internalInsertOrReplace (ioRootPtr->mInfPtr, inKey, ioAttributeArray, ioExtension) ;
       if (ioExtension) {
         ioRootPtr->mBalance++;
         if (ioRootPtr->mBalance == 0) {
@@ -573,7 +736,7 @@ static bool internalInsertOrReplace (cMapNode * & ioRootPtr,
         }
       }
     }else if (comparaison < 0) {
-      anObjectHasBeenAdded = internalInsertOrReplace (ioRootPtr->mSupPtr, inKey, ioAttributeArray, ioExtension) ;
+      addedNode = internalInsertOrReplace (ioRootPtr->mSupPtr, inKey, ioAttributeArray, ioExtension) ;
       if (ioExtension) {
         ioRootPtr->mBalance-- ;
         if (ioRootPtr->mBalance == 0) {
@@ -591,7 +754,7 @@ static bool internalInsertOrReplace (cMapNode * & ioRootPtr,
       ioRootPtr->mAttributes = ioAttributeArray ;
     }
   }
-  return anObjectHasBeenAdded ;
+  return addedNode ;
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -606,9 +769,10 @@ void cSharedMapRoot::performInsertOrReplace (const capCollectionElement & inAttr
     const String key = string_key.stringValue () ;
   //--- Insert or replace
     bool extension ; // Unused here
-    const bool anObjectHasBeenAdded = internalInsertOrReplace (mRoot, key, inAttributes, extension) ;
-    if (anObjectHasBeenAdded) {
+    cMapNode * addedNode = internalInsertOrReplace (mRoot, key, inAttributes, extension) ;
+    if (nullptr != addedNode) {
       mCount ++ ;
+      insertedNode (addedNode) ;
     }
   }
   #ifndef DO_NOT_GENERATE_CHECKINGS
@@ -640,6 +804,7 @@ mInfPtr (nullptr),
 mSupPtr (nullptr),
 mBalance (inNode->mBalance),
 mKey (inNode->mKey),
+mKeyHash (inNode->mKeyHash),
 mAttributes (inNode->mAttributes) {
   if (inNode->mInfPtr != nullptr) {
     macroMyNew (mInfPtr, cMapNode (inNode->mInfPtr)) ;
@@ -803,6 +968,7 @@ cMapNode * cSharedMapRoot::performInsert (const capCollectionElement & inAttribu
     if (! entryAlreadyExists) {
       result = matchingEntry ;
       mCount ++ ;
+      insertedNode (matchingEntry) ;
       const String shadowErrorMessage (inShadowErrorMessage) ;
       const int32_t shadowErrorMessageLength = shadowErrorMessage.length () ;
       if (shadowErrorMessageLength > 0) {
@@ -1508,6 +1674,7 @@ void cSharedMapRoot::performRemove (GALGAS_lstring & inKey,
       inCompiler->semanticErrorAtLocation (key_location, message, TC_Array <C_FixItDescription> () COMMA_THERE) ;
     }else{ // Ok, found
       outResult = node->mAttributes ;
+      removeNodeFromHashIndex (node) ;
       macroMyDelete (node) ;
       mCount -- ;
     }
@@ -39,6 +39,9 @@ class cSortedListNode {
   public: cSortedListNode * mPreviousPtr ;
   public: capSortedListElement mProperties ;
 
+//--- Allocation by size class (release mode)
+  macroUseSizeClassAllocation
+
 //---
   public: cSortedListNode (const capSortedListElement & inAttributes) ;
 
@@ -50,6 +50,24 @@ gOption_galgas_5F_builtin_5F_options_do_5F_not_5F_generate_5F_any_5F_file ("galg
 
 //--------------------------------------------------------------------------------------------------
 
+C_BoolCommandLineOption
+gOption_galgas_5F_builtin_5F_options_incremental ("galgas_cli_options",
+                                                  "incremental",
+                                                  '\0',
+                                                  "incremental",
+                                                  "Skip the generation when the source files, the files read and the options did not change since the previous run") ;
+
+//--------------------------------------------------------------------------------------------------
+
+C_BoolCommandLineOption
+gOption_galgas_5F_builtin_5F_options_profile ("galgas_cli_options",
+                                              "profile",
+                                              '\0',
+                                              "profile",
+                                              "Report the wall time and the allocations of the phases, source files and functions in build/<file>.profile.json") ;
+
+//--------------------------------------------------------------------------------------------------
+
 C_BoolCommandLineOption
 gOption_galgas_5F_builtin_5F_options_treat_5F_warnings_5F_as_5F_error ("galgas_cli_options",
                                                                        "treat_warnings_as_error",
@@ -95,6 +113,15 @@ C_StringCommandLineOption gOption_galgas_5F_builtin_5F_options_outputKeywordList
                                          "Output a Latex file containing keyword list",
                                          "") ;
 
+//--------------------------------------------------------------------------------------------------
+
+C_StringCommandLineOption gOption_galgas_5F_builtin_5F_options_serve ("galgas_cli_options",
+                                         "serve",
+                                         0,
+                                         "serve",
+                                         "Listen on the given Unix socket and run the commands sent to it (see the <TOOL>_SERVER environment variable)",
+                                         "") ;
+
 //--------------------------------------------------------------------------------------------------
 //
 //   EXECUTION MODE
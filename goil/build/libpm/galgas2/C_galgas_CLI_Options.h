@@ -40,6 +40,14 @@ extern C_BoolCommandLineOption gOption_galgas_5F_builtin_5F_options_do_5F_not_5F
 
 //--------------------------------------------------------------------------------------------------
 
+extern C_BoolCommandLineOption gOption_galgas_5F_builtin_5F_options_incremental ;
+
+//--------------------------------------------------------------------------------------------------
+
+extern C_BoolCommandLineOption gOption_galgas_5F_builtin_5F_options_profile ;
+
+//--------------------------------------------------------------------------------------------------
+
 extern C_BoolCommandLineOption gOption_galgas_5F_builtin_5F_options_treat_5F_warnings_5F_as_5F_error ;
 
 //--------------------------------------------------------------------------------------------------
@@ -60,6 +68,11 @@ extern C_StringCommandLineOption gOption_galgas_5F_builtin_5F_options_outputKeyw
 
 //--------------------------------------------------------------------------------------------------
 
+//--- Handled by main before the command line is analyzed, see F_mainForLIBPM.cpp
+extern C_StringCommandLineOption gOption_galgas_5F_builtin_5F_options_serve ;
+
+//--------------------------------------------------------------------------------------------------
+
 void setExecutionMode (String & outErrorMessage) ;
 
 typedef enum {
@@ -116,6 +116,13 @@ int32_t totalWarningCount (void) {
   return mTotalWarningCount ;
 }
 
+//--------------------------------------------------------------------------------------------------
+
+void resetErrorAndWarningCounts (void) {
+  mErrorTotalCount = 0 ;
+  mTotalWarningCount = 0 ;
+}
+
 //--------------------------------------------------------------------------------------------------
 //
 //    Construct error or warning location message
@@ -146,6 +146,9 @@ int32_t totalErrorCount (void) ;
 int32_t maxWarningCount (void) ;
 
 int32_t totalWarningCount (void) ;
+
+//--- Before each command run by a server
+void resetErrorAndWarningCounts (void) ;
  
 void signalParsingError (Compiler * inCompiler,
                          const SourceTextInString & inSourceText,
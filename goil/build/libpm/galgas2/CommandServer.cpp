@@ -0,0 +1,435 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  CommandServer : run the commands of several clients in one long-running process
+//
+//  This file is part of libpm library
+//
+//  This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+//  Public License as published by the Free Software Foundation; either version 2 of the License, or (at your option)
+//  any later version.
+//
+//  This program is distributed in the hope it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//  warranty of MERCHANDIBILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+//  more details.
+//
+//--------------------------------------------------------------------------------------------------
+
+#include "CommandServer.h"
+#include "F_Analyze_CLI_Options.h"
+#include "F_DisplayException.h"
+#include "C_galgas_io.h"
+#include "C_ConsoleOut.h"
+#include "GenerationManifest.h"
+#include "ParsingCache.h"
+
+//--------------------------------------------------------------------------------------------------
+
+#include <string>
+#include <vector>
+#include <stdio.h>
+
+//--------------------------------------------------------------------------------------------------
+
+#if COMPILE_FOR_WINDOWS == 0
+  #include <errno.h>
+  #include <signal.h>
+  #include <stdlib.h>
+  #include <string.h>
+  #include <sys/socket.h>
+  #include <sys/un.h>
+  #include <unistd.h>
+
+  extern char ** environ ;
+#endif
+
+//--------------------------------------------------------------------------------------------------
+//
+//  Protocol, on a connection:
+//    - the client sends a message with the length of the command (uint32_t) and, as ancillary
+//      data, its standard output and standard error file descriptors;
+//    - the client sends the command: NUL terminated strings, the working directory, the argument
+//      count, the arguments, then the environment variables up to the end of the command;
+//    - the server runs the command and sends its return code (int32_t).
+//
+//--------------------------------------------------------------------------------------------------
+
+static bool gServing = false ;
+
+//--------------------------------------------------------------------------------------------------
+
+bool CommandServer::isServing (void) {
+  return gServing ;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+#if COMPILE_FOR_WINDOWS == 0
+  static bool writeAll (const int inFileDescriptor, const void * inData, const size_t inLength) {
+    const char * p = (const char *) inData ;
+    size_t remaining = inLength ;
+    bool ok = true ;
+    while (ok && (remaining > 0)) {
+      const ssize_t n = ::write (inFileDescriptor, p, remaining) ;
+      if (n > 0) {
+        p += n ;
+        remaining -= size_t (n) ;
+      }else{
+        ok = (n < 0) && (errno == EINTR) ;
+      }
+    }
+    return ok ;
+  }
+#endif
+
+//--------------------------------------------------------------------------------------------------
+
+#if COMPILE_FOR_WINDOWS == 0
+  static bool readAll (const int inFileDescriptor, void * outData, const size_t inLength) {
+    char * p = (char *) outData ;
+    size_t remaining = inLength ;
+    bool ok = true ;
+    while (ok && (remaining > 0)) {
+      const ssize_t n = ::read (inFileDescriptor, p, remaining) ;
+      if (n > 0) {
+        p += n ;
+        remaining -= size_t (n) ;
+      }else{
+        ok = (n < 0) && (errno == EINTR) ;
+      }
+    }
+    return ok ;
+  }
+#endif
+
+//--------------------------------------------------------------------------------------------------
+
+#if COMPILE_FOR_WINDOWS == 0
+  static bool socketAddress (const char * inSocketPath, struct sockaddr_un & outAddress) {
+    ::memset (& outAddress, 0, sizeof (outAddress)) ;
+    outAddress.sun_family = AF_UNIX ;
+    const bool ok = ::strlen (inSocketPath) < sizeof (outAddress.sun_path) ;
+    if (ok) {
+      ::strcpy (outAddress.sun_path, inSocketPath) ;
+    }
+    return ok ;
+  }
+#endif
+
+//--------------------------------------------------------------------------------------------------
+
+#if COMPILE_FOR_WINDOWS == 0
+  static int connectedSocket (const char * inSocketPath) {
+    struct sockaddr_un address ;
+    int result = -1 ;
+    if (socketAddress (inSocketPath, address)) {
+      result = ::socket (AF_UNIX, SOCK_STREAM, 0) ;
+      if ((result >= 0) && (::connect (result, (const struct sockaddr *) & address, sizeof (address)) != 0)) {
+        ::close (result) ;
+        result = -1 ;
+      }
+    }
+    return result ;
+  }
+#endif
+
+//--------------------------------------------------------------------------------------------------
+//   CLIENT
+//--------------------------------------------------------------------------------------------------
+
+bool CommandServer::forwardCommand (const char * inSocketPath,
+                                    const int inArgc,
+                                    const char * inArgv [],
+                                    int & outReturnCode) {
+  bool forwarded = false ;
+  #if COMPILE_FOR_WINDOWS == 0
+    const int connection = ((nullptr == inSocketPath) || (inSocketPath [0] == '\0') || gServing)
+      ? -1
+      : connectedSocket (inSocketPath) ;
+    if (connection >= 0) {
+    //--- Command
+      std::string command ;
+      char * currentDirectory = ::getcwd (nullptr, 0) ;
+      if (nullptr != currentDirectory) {
+        command.append (currentDirectory) ;
+        ::free (currentDirectory) ;
+      }
+      command.push_back ('\0') ;
+      command.append (std::to_string (inArgc)) ;
+      command.push_back ('\0') ;
+      for (int i=0 ; i<inArgc ; i++) {
+        command.append (inArgv [i]) ;
+        command.push_back ('\0') ;
+      }
+      for (char ** p = environ ; *p != nullptr ; p++) {
+        command.append (*p) ;
+        command.push_back ('\0') ;
+      }
+    //--- Length and file descriptors
+      uint32_t length = uint32_t (command.size ()) ;
+      struct iovec iov ;
+      iov.iov_base = & length ;
+      iov.iov_len = sizeof (length) ;
+      const int fileDescriptors [2] = {STDOUT_FILENO, STDERR_FILENO} ;
+      union {
+        char buffer [CMSG_SPACE (sizeof (fileDescriptors))] ;
+        struct cmsghdr align ;
+      } control ;
+      ::memset (& control, 0, sizeof (control)) ;
+      struct msghdr message ;
+      ::memset (& message, 0, sizeof (message)) ;
+      message.msg_iov = & iov ;
+      message.msg_iovlen = 1 ;
+      message.msg_control = control.buffer ;
+      message.msg_controllen = sizeof (control.buffer) ;
+      struct cmsghdr * cmsg = CMSG_FIRSTHDR (& message) ;
+      cmsg->cmsg_level = SOL_SOCKET ;
+      cmsg->cmsg_type = SCM_RIGHTS ;
+      cmsg->cmsg_len = CMSG_LEN (sizeof (fileDescriptors)) ;
+      ::memcpy (CMSG_DATA (cmsg), fileDescriptors, sizeof (fileDescriptors)) ;
+      fflush (stdout) ;
+      fflush (stderr) ;
+      const bool sent = (::sendmsg (connection, & message, 0) == ssize_t (sizeof (length)))
+        && writeAll (connection, command.data (), command.size ()) ;
+    //--- Wait for the return code; once sent, the command is not run again locally
+      if (sent) {
+        forwarded = true ;
+        int32_t returnCode = 1 ;
+        if (! readAll (connection, & returnCode, sizeof (returnCode))) {
+          fprintf (stderr, "*** Error: the server at '%s' has closed the connection ***\n", inSocketPath) ;
+          returnCode = 1 ;
+        }
+        outReturnCode = int (returnCode) ;
+      }
+      ::close (connection) ;
+    }
+  #else
+    (void) inSocketPath ;
+    (void) inArgc ;
+    (void) inArgv ;
+    (void) outReturnCode ;
+  #endif
+  return forwarded ;
+}
+
+//--------------------------------------------------------------------------------------------------
+//   SERVER
+//--------------------------------------------------------------------------------------------------
+
+#if COMPILE_FOR_WINDOWS == 0
+  static volatile sig_atomic_t gStopRequested = 0 ;
+
+  static void stopServer (int /* inSignal */) {
+    gStopRequested = 1 ;
+  }
+#endif
+
+//--------------------------------------------------------------------------------------------------
+
+#if COMPILE_FOR_WINDOWS == 0
+  static void setEnvironment (const std::vector <std::string> & inVariables) {
+    std::vector <std::string> names ;
+    for (char ** p = environ ; *p != nullptr ; p++) {
+      const std::string variable (*p) ;
+      names.push_back (variable.substr (0, variable.find ('='))) ;
+    }
+    for (size_t i=0 ; i<names.size () ; i++) {
+      ::unsetenv (names [i].c_str ()) ;
+    }
+    for (size_t i=0 ; i<inVariables.size () ; i++) {
+      const size_t equalIndex = inVariables [i].find ('=') ;
+      if ((equalIndex != std::string::npos) && (equalIndex > 0)) {
+        ::setenv (inVariables [i].substr (0, equalIndex).c_str (), inVariables [i].c_str () + equalIndex + 1, 1) ;
+      }
+    }
+  }
+#endif
+
+//--------------------------------------------------------------------------------------------------
+
+#if COMPILE_FOR_WINDOWS == 0
+  static int runCommand (const std::vector <std::string> & inStrings,
+                         int (* inMainRoutine) (int inArgc, const char * inArgv [])) {
+    int returnCode = 1 ;
+    const int argc = (inStrings.size () > 1) ? ::atoi (inStrings [1].c_str ()) : -1 ;
+    if ((argc < 1) || (size_t (argc) + 2 > inStrings.size ())) {
+      fprintf (stderr, "*** Error: invalid command ***\n") ;
+    }else if (::chdir (inStrings [0].c_str ()) != 0) {
+      fprintf (stderr, "*** Error: cannot set the working directory to '%s' ***\n", inStrings [0].c_str ()) ;
+    }else{
+      std::vector <const char *> argv ;
+      for (int i=0 ; i<argc ; i++) {
+        argv.push_back (inStrings [size_t (i) + 2].c_str ()) ;
+      }
+      argv.push_back (nullptr) ;
+      setEnvironment (std::vector <std::string> (inStrings.begin () + argc + 2, inStrings.end ())) ;
+      resetCommandLineOptions () ;
+      resetErrorAndWarningCounts () ;
+      GenerationManifest::reset () ;
+      setCommandLineArguments (argc, argv.data ()) ;
+      try{
+        returnCode = inMainRoutine (argc, argv.data ()) ;
+      }catch (const std::exception & e) {
+        F_default_display_exception (e) ;
+        returnCode = 1 ;
+      }catch (...) {
+        F_default_display_unknown_exception () ;
+        returnCode = 2 ;
+      }
+      setCommandLineArguments (0, nullptr) ;
+    //--- What the command leaves in memory is not reused by the next ones
+      ParsingCache::release () ;
+      String::releaseInternedStrings () ;
+    }
+    return returnCode ;
+  }
+#endif
+
+//--------------------------------------------------------------------------------------------------
+
+#if COMPILE_FOR_WINDOWS == 0
+  static void handleConnection (const int inConnection,
+                                int (* inMainRoutine) (int inArgc, const char * inArgv [])) {
+  //--- Length and file descriptors
+    uint32_t length = 0 ;
+    struct iovec iov ;
+    iov.iov_base = & length ;
+    iov.iov_len = sizeof (length) ;
+    int fileDescriptors [2] = {-1, -1} ;
+    union {
+      char buffer [CMSG_SPACE (sizeof (fileDescriptors))] ;
+      struct cmsghdr align ;
+    } control ;
+    ::memset (& control, 0, sizeof (control)) ;
+    struct msghdr message ;
+    ::memset (& message, 0, sizeof (message)) ;
+    message.msg_iov = & iov ;
+    message.msg_iovlen = 1 ;
+    message.msg_control = control.buffer ;
+    message.msg_controllen = sizeof (control.buffer) ;
+    bool ok = ::recvmsg (inConnection, & message, 0) == ssize_t (sizeof (length)) ;
+    const struct cmsghdr * cmsg = ok ? CMSG_FIRSTHDR (& message) : nullptr ;
+    ok = (nullptr != cmsg)
+      && (cmsg->cmsg_level == SOL_SOCKET)
+      && (cmsg->cmsg_type == SCM_RIGHTS)
+      && (cmsg->cmsg_len == CMSG_LEN (sizeof (fileDescriptors))) ;
+    if (ok) {
+      ::memcpy (fileDescriptors, CMSG_DATA (cmsg), sizeof (fileDescriptors)) ;
+    }
+  //--- Command
+    std::string command ;
+    if (ok) {
+      command.resize (length) ;
+      ok = readAll (inConnection, & command [0], length) ;
+    }
+    if (ok) {
+      std::vector <std::string> strings ;
+      size_t start = 0 ;
+      for (size_t i=0 ; i<command.size () ; i++) {
+        if (command [i] == '\0') {
+          strings.push_back (command.substr (start, i - start)) ;
+          start = i + 1 ;
+        }
+      }
+    //--- Run with the standard output and standard error of the client
+      gCout.flush () ;
+      fflush (stdout) ;
+      fflush (stderr) ;
+      const int savedStdout = ::dup (STDOUT_FILENO) ;
+      const int savedStderr = ::dup (STDERR_FILENO) ;
+      ::dup2 (fileDescriptors [0], STDOUT_FILENO) ;
+      ::dup2 (fileDescriptors [1], STDERR_FILENO) ;
+      const int32_t returnCode = int32_t (runCommand (strings, inMainRoutine)) ;
+      gCout.flush () ;
+      fflush (stdout) ;
+      fflush (stderr) ;
+      ::dup2 (savedStdout, STDOUT_FILENO) ;
+      ::dup2 (savedStderr, STDERR_FILENO) ;
+      ::close (savedStdout) ;
+      ::close (savedStderr) ;
+      writeAll (inConnection, & returnCode, sizeof (returnCode)) ;
+    }
+    for (int i=0 ; i<2 ; i++) {
+      if (fileDescriptors [i] >= 0) {
+        ::close (fileDescriptors [i]) ;
+      }
+    }
+  }
+#endif
+
+//--------------------------------------------------------------------------------------------------
+
+int CommandServer::serve (const String & inSocketPath,
+                          int (* inMainRoutine) (int inArgc, const char * inArgv [])) {
+  int result = 1 ;
+  #if COMPILE_FOR_WINDOWS == 0
+    const std::string socketPath (inSocketPath.cString ()) ;
+    struct sockaddr_un address ;
+    int listener = -1 ;
+    if (! socketAddress (socketPath.c_str (), address)) {
+      fprintf (stderr, "*** Error: the socket path '%s' is too long ***\n", socketPath.c_str ()) ;
+    }else{
+    //--- A socket file that does not accept connections is left by a stopped server
+      const int connection = connectedSocket (socketPath.c_str ()) ;
+      if (connection >= 0) {
+        ::close (connection) ;
+        fprintf (stderr, "*** Error: a server is already listening on '%s' ***\n", socketPath.c_str ()) ;
+      }else{
+        ::unlink (socketPath.c_str ()) ;
+        listener = ::socket (AF_UNIX, SOCK_STREAM, 0) ;
+        if ((listener < 0)
+         || (::bind (listener, (const struct sockaddr *) & address, sizeof (address)) != 0)
+         || (::listen (listener, 16) != 0)) {
+          fprintf (stderr, "*** Error: cannot listen on '%s': %s ***\n", socketPath.c_str (), ::strerror (errno)) ;
+          if (listener >= 0) {
+            ::close (listener) ;
+            listener = -1 ;
+          }
+        }
+      }
+    }
+    if (listener >= 0) {
+    //--- Stop on SIGINT and SIGTERM: accept is interrupted (no SA_RESTART); a client that goes
+    //    away while its command runs must not stop the server (SIGPIPE)
+      struct sigaction action ;
+      ::memset (& action, 0, sizeof (action)) ;
+      action.sa_handler = stopServer ;
+      sigemptyset (& action.sa_mask) ;
+      struct sigaction previousSigint ;
+      struct sigaction previousSigterm ;
+      struct sigaction previousSigpipe ;
+      ::sigaction (SIGINT, & action, & previousSigint) ;
+      ::sigaction (SIGTERM, & action, & previousSigterm) ;
+      action.sa_handler = SIG_IGN ;
+      ::sigaction (SIGPIPE, & action, & previousSigpipe) ;
+      gStopRequested = 0 ;
+      gServing = true ;
+      gCout.appendCString ("Listening on '") ;
+      gCout.appendCString (socketPath.c_str ()) ;
+      gCout.appendCString ("'\n") ;
+      gCout.flush () ;
+      while (gStopRequested == 0) {
+        const int connection = ::accept (listener, nullptr, nullptr) ;
+        if (connection >= 0) {
+          handleConnection (connection, inMainRoutine) ;
+          ::close (connection) ;
+        }else if (errno != EINTR) {
+          fprintf (stderr, "*** Error: cannot accept a connection on '%s': %s ***\n", socketPath.c_str (), ::strerror (errno)) ;
+          gStopRequested = 1 ;
+        }
+      }
+      gServing = false ;
+      ::sigaction (SIGINT, & previousSigint, nullptr) ;
+      ::sigaction (SIGTERM, & previousSigterm, nullptr) ;
+      ::sigaction (SIGPIPE, & previousSigpipe, nullptr) ;
+      ::close (listener) ;
+      ::unlink (socketPath.c_str ()) ;
+      result = 0 ;
+    }
+  #else
+    (void) inMainRoutine ;
+    fprintf (stderr, "*** Error: cannot serve on '%s', not available on Windows ***\n", inSocketPath.cString ()) ;
+  #endif
+  return result ;
+}
+
+//--------------------------------------------------------------------------------------------------
@@ -0,0 +1,58 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  CommandServer : run the commands of several clients in one long-running process
+//
+//  This file is part of libpm library
+//
+//  This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+//  Public License as published by the Free Software Foundation; either version 2 of the License, or (at your option)
+//  any later version.
+//
+//  This program is distributed in the hope it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//  warranty of MERCHANDIBILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+//  more details.
+//
+//--------------------------------------------------------------------------------------------------
+
+#pragma once
+
+//--------------------------------------------------------------------------------------------------
+
+#include "String-class.h"
+
+//--------------------------------------------------------------------------------------------------
+//
+//  The server listens on a Unix domain socket and runs the commands it receives one at a time,
+//  so that a command does not pay for the start of a process.
+//  A command is run by the main routine of the tool, with the command line arguments, the working
+//  directory and the environment variables of the client, and writes directly to the standard
+//  output and standard error of the client, whose file descriptors are sent along the command.
+//  Before each command, the command line options are reset to their default values, the
+//  error and warning counts are cleared and the generation manifest state is reset; after each
+//  command, the parsing cache and the interned strings are released, so that a command does not
+//  see what the previous ones left. The server stops on SIGINT or SIGTERM, removes its socket
+//  and restores the previous SIGINT, SIGTERM and SIGPIPE handlers.
+//
+//  The client sends its command and waits for the return code of the command.
+//
+//  Not available on Windows: serve fails and forwardCommand returns false.
+//
+//--------------------------------------------------------------------------------------------------
+
+class CommandServer final {
+//--- Server: returns 0 when stopped by a signal, 1 if the socket cannot be set up
+  public: static int serve (const String & inSocketPath,
+                            int (* inMainRoutine) (int inArgc, const char * inArgv [])) ;
+
+//--- True while a server runs, a command run by a server is not forwarded again
+  public: static bool isServing (void) ;
+
+//--- Client: returns false if no server accepts the command at inSocketPath (nullptr or empty
+//    path: no server), the command should then be run by the calling process.
+  public: static bool forwardCommand (const char * inSocketPath,
+                                      const int inArgc,
+                                      const char * inArgv [],
+                                      int & outReturnCode) ;
+} ;
+
+//--------------------------------------------------------------------------------------------------
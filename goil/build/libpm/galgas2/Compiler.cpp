@@ -21,6 +21,7 @@
 #include "F_Analyze_CLI_Options.h"
 #include "TextFileWrite.h"
 #include "FileManager.h"
+#include "GenerationManifest.h"
 #include "Compiler.h"
 #include "C_galgas_io.h"
 #include "C_galgas_CLI_Options.h"
@@ -242,6 +243,7 @@ void Compiler::printMessage (const String & inMessage
 //--------------------------------------------------------------------------------------------------
 
 void Compiler::logFileRead (const String & inFilePath) {
+  GenerationManifest::recordInputFile (inFilePath) ;
   if (performLogFileRead ()) {
     printf ("Reading '%s' file.\n", inFilePath.cString ()) ;
   }
@@ -249,6 +251,35 @@ void Compiler::logFileRead (const String & inFilePath) {
 
 //--------------------------------------------------------------------------------------------------
 
+#ifdef PRAGMA_MARK_ALLOWED
+  #pragma mark Enqueued file writes
+#endif
+
+//--------------------------------------------------------------------------------------------------
+
+void Compiler::reportEnqueuedFileWrites (LOCATION_ARGS) {
+  TC_UniqueArray <String> filePathes ;
+  TC_UniqueArray <FileManager::EnqueuedWriteResult> results ;
+  FileManager::waitForEnqueuedWrites (filePathes, results) ;
+  const bool verboseOptionOn = verboseOutput () ;
+  for (int32_t i=0 ; i<filePathes.count () ; i++) {
+    const String & filePath = filePathes (i COMMA_HERE) ;
+    const FileManager::EnqueuedWriteResult result = results (i COMMA_HERE) ;
+    if (result == FileManager::EnqueuedWriteResult::failed) {
+      String message = "cannot write '" ;
+      message.appendString (filePath) ;
+      message.appendCString ("' file") ;
+      onTheFlyRunTimeError (message COMMA_THERE) ;
+    }else if (verboseOptionOn && (result == FileManager::EnqueuedWriteResult::replaced)) {
+      ggs_printFileOperationSuccess (String ("Replaced '") + filePath + "'.\n") ;
+    }else if (verboseOptionOn) {
+      ggs_printFileCreationSuccess (String ("Created '") + filePath + "'.\n") ;
+    }
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+
 #ifdef PRAGMA_MARK_ALLOWED
   #pragma mark Loop variant run time error
 #endif
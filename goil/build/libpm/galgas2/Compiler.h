@@ -80,7 +80,7 @@ class Compiler : public SharedObject {
   private: SourceTextInString mSourceText ;
   protected: LocationInSource mCurrentLocation ;
 
-  public: inline SourceTextInString sourceText (void) const {
+  public: inline const SourceTextInString & sourceText (void) const {
     return mSourceText ;
   }
 
@@ -196,6 +196,15 @@ class Compiler : public SharedObject {
 //--- File generation
   public: static bool performGeneration (void) ;
 
+//--- Wait for the files enqueued for writing (see FileManager::enqueueStringWrite), then print the
+//    "Created" and "Replaced" messages and signal the write errors
+  public: void reportEnqueuedFileWrites (LOCATION_ARGS) ;
+
+//--- Compiler that has created this one, nullptr for the compiler of the main routine
+  public: inline Compiler * callerCompiler (void) const {
+    return mCallerCompiler ;
+  }
+
 //--- Generate file in directory
   public: void generateFile (const String & inLineCommentPrefix,
                               const TC_UniqueArray <String> & inDirectoriesToExclude,
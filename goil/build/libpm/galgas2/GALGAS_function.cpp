@@ -23,6 +23,7 @@
 #include "C_galgas_type_descriptor.h"
 #include "Compiler.h"
 #include "cObjectArray.h"
+#include "Profiler.h"
 
 //--------------------------------------------------------------------------------------------------
 //
@@ -204,6 +205,7 @@ GALGAS_object GALGAS_function::getter_invoke (const GALGAS_objectlist & inObject
 //--- Invoke function
   GALGAS_object result ;
   if (ok) {
+    const ProfilerSection section ("function", mFunctionDescriptor->mFunctionName) ;
     result = mFunctionDescriptor->mFunctionPointer (inCompiler, argumentsArray, inErrorLocation COMMA_THERE) ;
   }
   return result ;
@@ -26,6 +26,7 @@
 #include "unicode_character_cpp.h"
 #include "C_galgas_io.h"
 #include "FileManager.h"
+#include "GenerationManifest.h"
 #include "BinaryFileWrite.h"
 #include "F_verbose_output.h"
 
@@ -82,7 +83,9 @@ GALGAS_lstring GALGAS_string::getter_here (Compiler * inCompiler COMMA_LOCATION_
 GALGAS_bool GALGAS_string::getter_fileExists (UNUSED_LOCATION_ARGS) const {
   GALGAS_bool result ;
   if (isValid ()) {
-    result = GALGAS_bool (FileManager::fileExistsAtPath (mString)) ;
+    const bool exists = FileManager::fileExistsAtPath (mString) ;
+    GenerationManifest::recordFileExistenceTest (mString, exists) ;
+    result = GALGAS_bool (exists) ;
   }
   return result ;
 }
@@ -969,7 +972,9 @@ GALGAS_stringlist GALGAS_string::getter_directoriesWithExtensions (const GALGAS_
 GALGAS_bool GALGAS_string::getter_doesEnvironmentVariableExist (UNUSED_LOCATION_ARGS) const {
   GALGAS_bool result ;
   if (isValid ()) {
-    result = GALGAS_bool (::getenv (mString.cString ()) != nullptr) ;
+    const char * value = ::getenv (mString.cString ()) ;
+    GenerationManifest::recordEnvironmentVariable (mString, value) ;
+    result = GALGAS_bool (value != nullptr) ;
   }
   return result ;
 }
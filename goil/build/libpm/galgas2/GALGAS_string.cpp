@@ -22,6 +22,7 @@
 #include "Compiler.h"
 #include "C_galgas_io.h"
 #include "FileManager.h"
+#include "GenerationManifest.h"
 #include "BinaryFileWrite.h"
 #include "F_verbose_output.h"
 
@@ -278,6 +279,7 @@ GALGAS_string GALGAS_string::class_func_stringWithEnvironmentVariable (const GAL
   GALGAS_string result ;
   if (inEnvironmentVariableName.isValid ()) {
     const char * value = ::getenv (inEnvironmentVariableName.mString.cString ()) ;
+    GenerationManifest::recordEnvironmentVariable (inEnvironmentVariableName.mString, value) ;
     if (value == nullptr) {
       String message = "the '" ;
       message.appendString (inEnvironmentVariableName.mString) ;
@@ -297,6 +299,7 @@ GALGAS_string GALGAS_string::class_func_stringWithEnvironmentVariableOrEmpty (co
   GALGAS_string result ;
   if (inEnvironmentVariableName.isValid ()) {
     const char * value = ::getenv (inEnvironmentVariableName.mString.cString ()) ;
+    GenerationManifest::recordEnvironmentVariable (inEnvironmentVariableName.mString, value) ;
     result = GALGAS_string (value) ;
   }
   return result ;
@@ -478,20 +481,10 @@ void GALGAS_string::method_writeToFile (GALGAS_string inFilePath,
                                         Compiler * inCompiler
                                         COMMA_LOCATION_ARGS) const {
   if (isValid () && inFilePath.isValid ()) {
+    GenerationManifest::recordOutputFile (inFilePath.mString) ;
     if (Compiler::performGeneration ()) {
-      const bool fileAlreadyExists = FileManager::fileExistsAtPath (inFilePath.mString) ;
-      const bool verboseOptionOn = verboseOutput () ;
-      const bool ok = FileManager::writeStringToFile (mString, inFilePath.mString) ;
-      if (ok && verboseOptionOn && fileAlreadyExists) {
-        ggs_printFileOperationSuccess (String ("Replaced '") + inFilePath.mString + "'.\n") ;
-      }else if (ok && verboseOptionOn && ! fileAlreadyExists) {
-        ggs_printFileCreationSuccess (String ("Created '") + inFilePath.mString + "'.\n") ;
-      }else if (! ok) {
-        String message = "cannot write '" ;
-        message.appendString (inFilePath.mString) ;
-        message.appendCString ("' file") ;
-        inCompiler->onTheFlyRunTimeError (message COMMA_THERE) ;
-      }
+    //--- Written by a worker thread; success or failure is reported by Compiler::reportEnqueuedFileWrites
+      FileManager::enqueueStringWrite (mString, inFilePath.mString, false) ;
     }else{
       ggs_printWarning (inCompiler, SourceTextInString (), C_IssueWithFixIt (), String ("Need to write '") + inFilePath.mString + "'." COMMA_THERE) ;
     }
@@ -505,6 +498,7 @@ void GALGAS_string::method_writeToFileWhenDifferentContents (GALGAS_string inFil
                                                              Compiler * inCompiler
                                                              COMMA_LOCATION_ARGS) const {
   if (isValid () && inFilePath.isValid ()) {
+    GenerationManifest::recordOutputFile (inFilePath.mString) ;
     bool needToWrite = true ;
     const bool fileAlreadyExists = FileManager::fileExistsAtPath (inFilePath.mString) ;
     if (fileAlreadyExists) {
@@ -550,20 +544,10 @@ void GALGAS_string::method_writeToExecutableFile (GALGAS_string inFilePath,
                                                   Compiler * inCompiler
                                                   COMMA_LOCATION_ARGS) const {
   if (isValid () && inFilePath.isValid ()) {
-    const bool fileAlreadyExists = FileManager::fileExistsAtPath (inFilePath.mString) ;
+    GenerationManifest::recordOutputFile (inFilePath.mString) ;
     if (Compiler::performGeneration ()) {
-      const bool verboseOptionOn = verboseOutput () ;
-      const bool ok = FileManager::writeStringToExecutableFile (mString, inFilePath.mString) ;
-      if (ok && verboseOptionOn && fileAlreadyExists) {
-        ggs_printFileOperationSuccess (String ("Replaced '") + inFilePath.mString + "'.\n") ;
-      }else if (ok && verboseOptionOn && ! fileAlreadyExists) {
-        ggs_printFileCreationSuccess (String ("Created '") + inFilePath.mString + "'.\n") ;
-      }else if (! ok) {
-        String message = "cannot write '" ;
-        message.appendString (inFilePath.mString) ;
-        message.appendCString ("' file") ;
-        inCompiler->onTheFlyRunTimeError (message COMMA_THERE) ;
-      }
+    //--- Written by a worker thread; success or failure is reported by Compiler::reportEnqueuedFileWrites
+      FileManager::enqueueStringWrite (mString, inFilePath.mString, true) ;
     }else{
       ggs_printWarning (inCompiler, SourceTextInString (), C_IssueWithFixIt (), String ("Need to write '") + inFilePath.mString + "'." COMMA_THERE) ;
     }
@@ -577,6 +561,7 @@ void GALGAS_string::method_writeToExecutableFileWhenDifferentContents (GALGAS_st
                                                                        Compiler * inCompiler
                                                                        COMMA_LOCATION_ARGS) const {
   if (isValid () && inFilePath.isValid ()) {
+    GenerationManifest::recordOutputFile (inFilePath.mString) ;
     bool needToWrite = true ;
     const bool fileAlreadyExists = FileManager::fileExistsAtPath (inFilePath.mString) ;
     if (fileAlreadyExists) {
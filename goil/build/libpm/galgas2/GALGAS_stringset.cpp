@@ -102,6 +102,9 @@ class cStringsetNode {
   public: int32_t mBalance ;
   public: String mKey ;
 
+//--- Allocation by size class (release mode)
+  macroUseSizeClassAllocation
+
 //---
   public: cStringsetNode (const String & inString) ;
   public: cStringsetNode (const cStringsetNode * inNode) ;
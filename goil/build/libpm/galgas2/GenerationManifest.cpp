@@ -0,0 +1,288 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  GenerationManifest : record of the inputs and outputs of a code generation
+//
+//  This file is part of libpm library
+//
+//  This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+//  Public License as published by the Free Software Foundation; either version 2 of the License, or (at your option)
+//  any later version.
+//
+//  This program is distributed in the hope it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//  warranty of MERCHANDIBILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+//  more details.
+//
+//--------------------------------------------------------------------------------------------------
+
+#include "GenerationManifest.h"
+#include "Compiler.h"
+#include "C_galgas_io.h"
+#include "C_galgas_CLI_Options.h"
+#include "F_Analyze_CLI_Options.h"
+#include "FileManager.h"
+#include "SHA256.h"
+
+//--------------------------------------------------------------------------------------------------
+
+#include <fstream>
+#include <map>
+#include <set>
+#include <stdlib.h>
+#include <string>
+
+//--------------------------------------------------------------------------------------------------
+//  Recorded paths are kept as std::string, so that nothing is left to the memory checker
+//  when the tool exits.
+//--------------------------------------------------------------------------------------------------
+
+static bool gRecording = false ;
+static std::set <std::string> gInputFiles ;
+static std::map <std::string, bool> gExistenceTests ;
+static std::set <std::string> gOutputFiles ;
+//--- Name -> digest of the value ("-" if undefined); also noted when not recording, as the program
+//    may read them before the source file is opened
+static std::map <std::string, std::string> gEnvironmentVariables ;
+
+//--------------------------------------------------------------------------------------------------
+
+void GenerationManifest::reset (void) {
+  gRecording = false ;
+  gInputFiles.clear () ;
+  gExistenceTests.clear () ;
+  gOutputFiles.clear () ;
+  gEnvironmentVariables.clear () ;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void GenerationManifest::startRecording (void) {
+  gInputFiles.clear () ;
+  gExistenceTests.clear () ;
+  gOutputFiles.clear () ;
+  gRecording = true ;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void GenerationManifest::stopRecording (void) {
+  gRecording = false ;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void GenerationManifest::recordInputFile (const String & inFilePath) {
+  if (gRecording) {
+    gInputFiles.insert (inFilePath.cString ()) ;
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void GenerationManifest::recordFileExistenceTest (const String & inFilePath, const bool inExists) {
+  if (gRecording) {
+    gExistenceTests.insert (std::pair <std::string, bool> (inFilePath.cString (), inExists)) ;
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void GenerationManifest::recordOutputFile (const String & inFilePath) {
+  if (gRecording) {
+    gOutputFiles.insert (inFilePath.cString ()) ;
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+
+static std::string environmentVariableDigest (const char * inValue) {
+  std::string result = "-" ;
+  if (inValue != nullptr) {
+    SHA256 sha ;
+    sha.update (std::string (inValue)) ;
+    result = SHA256::toString (sha.digest ()) ;
+  }
+  return result ;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void GenerationManifest::recordEnvironmentVariable (const String & inName, const char * inValue) {
+  gEnvironmentVariables [inName.cString ()] = environmentVariableDigest (inValue) ;
+}
+
+static bool fileDigest (const std::string & inFilePath, std::string & outDigest) {
+  U8Data data ;
+  const bool ok = FileManager::binaryDataWithContentOfFile (String (inFilePath.c_str ()), data) ;
+  if (ok) {
+    SHA256 sha ;
+    sha.update (data.unsafeDataPointer (), size_t (data.count ())) ;
+    outDigest = SHA256::toString (sha.digest ()) ;
+  }
+  return ok ;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+static std::string keyDigest (const String & inKey) {
+  SHA256 sha ;
+  sha.update (std::string (inKey.cString ())) ;
+  return SHA256::toString (sha.digest ()) ;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+bool GenerationManifest::writeManifest (const String & inManifestFilePath,
+                                        const String & inKey) {
+  gRecording = false ;
+  String s ;
+  s.appendCString ("key ") ;
+  s.appendCString (keyDigest (inKey).c_str ()) ;
+  s.appendCString ("\n") ;
+  bool ok = true ;
+  for (std::set <std::string>::const_iterator it = gInputFiles.begin () ; ok && (it != gInputFiles.end ()) ; it++) {
+  //--- A generated file that is read back is an output, not an input
+    if (gOutputFiles.count (*it) == 0) {
+      std::string digest ;
+      ok = fileDigest (*it, digest) ;
+      s.appendCString ("input ") ;
+      s.appendCString (digest.c_str ()) ;
+      s.appendCString (" ") ;
+      s.appendCString (it->c_str ()) ;
+      s.appendCString ("\n") ;
+    }
+  }
+  for (std::map <std::string, bool>::const_iterator it = gExistenceTests.begin () ; it != gExistenceTests.end () ; it++) {
+    if (gOutputFiles.count (it->first) == 0) {
+      s.appendCString (it->second ? "probe 1 " : "probe 0 ") ;
+      s.appendCString (it->first.c_str ()) ;
+      s.appendCString ("\n") ;
+    }
+  }
+  for (std::map <std::string, std::string>::const_iterator it = gEnvironmentVariables.begin () ; it != gEnvironmentVariables.end () ; it++) {
+    s.appendCString ("env ") ;
+    s.appendCString (it->second.c_str ()) ;
+    s.appendCString (" ") ;
+    s.appendCString (it->first.c_str ()) ;
+    s.appendCString ("\n") ;
+  }
+  for (std::set <std::string>::const_iterator it = gOutputFiles.begin () ; ok && (it != gOutputFiles.end ()) ; it++) {
+    std::string digest ;
+    ok = fileDigest (*it, digest) ;
+    s.appendCString ("output ") ;
+    s.appendCString (digest.c_str ()) ;
+    s.appendCString (" ") ;
+    s.appendCString (it->c_str ()) ;
+    s.appendCString ("\n") ;
+  }
+  gInputFiles.clear () ;
+  gExistenceTests.clear () ;
+  gOutputFiles.clear () ;
+  if (ok) {
+    ok = FileManager::writeStringToFile (s, inManifestFilePath) ;
+  }else{
+    FileManager::deleteFile (inManifestFilePath) ;
+  }
+  return ok ;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+bool GenerationManifest::manifestIsUpToDate (const String & inManifestFilePath,
+                                             const String & inKey) {
+  std::ifstream manifest (FileManager::nativePathWithUnixPath (inManifestFilePath).cString ()) ;
+  bool upToDate = manifest.is_open () ;
+  bool keyFound = false ;
+  bool inputFound = false ;
+  bool outputFound = false ;
+  std::string line ;
+  while (upToDate && std::getline (manifest, line)) {
+    const size_t firstSpace = line.find (' ') ;
+    const std::string kind = line.substr (0, firstSpace) ;
+    const std::string rest = (firstSpace == std::string::npos) ? "" : line.substr (firstSpace + 1) ;
+    if (kind == "key") {
+      keyFound = true ;
+      upToDate = rest == keyDigest (inKey) ;
+    }else{
+      const size_t secondSpace = rest.find (' ') ;
+      const std::string value = rest.substr (0, secondSpace) ;
+      const std::string path = (secondSpace == std::string::npos) ? "" : rest.substr (secondSpace + 1) ;
+      if ((kind == "input") || (kind == "output")) {
+        inputFound = inputFound || (kind == "input") ;
+        outputFound = outputFound || (kind == "output") ;
+        std::string digest ;
+        upToDate = fileDigest (path, digest) && (digest == value) ;
+      }else if (kind == "probe") {
+        upToDate = FileManager::fileExistsAtPath (String (path.c_str ())) == (value == "1") ;
+      }else if (kind == "env") {
+        upToDate = environmentVariableDigest (::getenv (path.c_str ())) == value ;
+      }else{
+        upToDate = false ;
+      }
+    }
+  }
+  return upToDate && keyFound && inputFound && outputFound ;
+}
+
+//--------------------------------------------------------------------------------------------------
+//
+//  Incremental generation of the source files given on the command line
+//
+//--------------------------------------------------------------------------------------------------
+
+static String manifestFilePathForSourceFile (const String & inSourceFilePath) {
+  String result = inSourceFilePath.stringByDeletingLastPathComponent () ;
+  result.appendCString ("/build/") ;
+  result.appendString (inSourceFilePath.lastPathComponent ()) ;
+  result.appendCString (".manifest") ;
+  return result ;
+}
+
+//--------------------------------------------------------------------------------------------------
+//  Every option that changes the generated files is in the command line arguments
+//--------------------------------------------------------------------------------------------------
+
+static String generationKey (void) {
+  String result = projectVersionString () ;
+  result.appendCString ("\n") ;
+  result.appendString (FileManager::currentDirectory ()) ;
+  for (uint32_t i=1 ; i<commandLineArgumentCount () ; i++) {
+    result.appendCString ("\n") ;
+    result.appendString (commandLineArgumentAtIndex (i)) ;
+  }
+  return result ;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+static int32_t gErrorCountAtBeginning = 0 ;
+
+//--------------------------------------------------------------------------------------------------
+
+bool GenerationManifest::beginSourceFile (const String & inSourceFilePath) {
+  bool upToDate = false ;
+  if (gOption_galgas_5F_builtin_5F_options_incremental.mValue && Compiler::performGeneration ()) {
+    upToDate = (totalErrorCount () == 0)
+      && manifestIsUpToDate (manifestFilePathForSourceFile (inSourceFilePath), generationKey ()) ;
+    if (! upToDate) {
+      gErrorCountAtBeginning = totalErrorCount () ;
+      startRecording () ;
+    }
+  }
+  return upToDate ;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void GenerationManifest::endSourceFile (const String & inSourceFilePath) {
+  if (gRecording) {
+    const String manifestFilePath = manifestFilePathForSourceFile (inSourceFilePath) ;
+    if (gErrorCountAtBeginning == totalErrorCount ()) {
+      writeManifest (manifestFilePath, generationKey ()) ;
+    }else{
+      stopRecording () ;
+      FileManager::deleteFile (manifestFilePath) ;
+    }
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
@@ -0,0 +1,78 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  GenerationManifest : record of the inputs and outputs of a code generation
+//
+//  This file is part of libpm library
+//
+//  This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+//  Public License as published by the Free Software Foundation; either version 2 of the License, or (at your option)
+//  any later version.
+//
+//  This program is distributed in the hope it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//  warranty of MERCHANDIBILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+//  more details.
+//
+//--------------------------------------------------------------------------------------------------
+
+#pragma once
+
+//--------------------------------------------------------------------------------------------------
+
+#include "String-class.h"
+
+//--------------------------------------------------------------------------------------------------
+//
+//  While recording, every file read by a lexique or by the file reading getters, every file
+//  existence test and every written file is noted; the environment variables read by the program
+//  are always noted. The manifest written afterwards holds a SHA-256 of each read file, of each
+//  written file and of each environment variable value, the result of each existence test and a
+//  key (tool version, current directory, command line arguments). A later run with the same key
+//  can then tell, without parsing anything, that a new generation would produce the same files.
+//
+//  Manifest format (one entry per line, the path or the name is the end of the line):
+//    key <sha256 of the key>
+//    input <sha256 of the file contents> <path>
+//    probe <0 or 1> <path>
+//    env <sha256 of the value, - if undefined> <name>
+//    output <sha256 of the file contents> <path>
+//
+//  With the --incremental option, Lexique calls beginSourceFile and endSourceFile for every source
+//  file given on the command line; the manifest is build/<source file name>.manifest, next to the
+//  source file.
+//
+//--------------------------------------------------------------------------------------------------
+
+class GenerationManifest final {
+//--- Incremental generation: beginSourceFile returns true if the manifest of the source file is up
+//    to date (the source file does not need to be handled), and starts recording otherwise.
+//    endSourceFile writes the manifest if no error has been raised since beginSourceFile, and
+//    removes it otherwise.
+  public: static bool beginSourceFile (const String & inSourceFilePath) ;
+  public: static void endSourceFile (const String & inSourceFilePath) ;
+
+//--- Forgets the recorded files and the noted environment variables (before each command of a
+//    server started with --serve)
+  public: static void reset (void) ;
+
+//--- Recording
+  public: static void startRecording (void) ;
+  public: static void stopRecording (void) ;
+
+  public: static void recordInputFile (const String & inFilePath) ;
+  public: static void recordFileExistenceTest (const String & inFilePath, const bool inExists) ;
+  public: static void recordOutputFile (const String & inFilePath) ;
+  public: static void recordEnvironmentVariable (const String & inName, const char * inValue) ;
+
+//--- Write the manifest of the recorded files (recording is stopped)
+  public: static bool writeManifest (const String & inManifestFilePath,
+                                     const String & inKey) ;
+
+//--- Returns true if the manifest exists, has been written with the same key, every read file has
+//    the same contents, every existence test gives the same result, every environment variable
+//    has the same value and every written file still has the contents it was written with; a
+//    manifest without written file is never up to date.
+  public: static bool manifestIsUpToDate (const String & inManifestFilePath,
+                                          const String & inKey) ;
+} ;
+
+//--------------------------------------------------------------------------------------------------
@@ -26,6 +26,7 @@
 #include "C_galgas_CLI_Options.h"
 #include "cIndexingDictionary.h"
 #include "FileManager.h"
+#include "Profiler.h"
 #include "F_verbose_output.h"
 
 //--------------------------------------------------------------------------------------------------
@@ -329,6 +330,14 @@ static void indentForParseOnly (const int32_t inIndentation) {
   }
 }
 
+//--------------------------------------------------------------------------------------------------
+//  Grammar of the source files of the command line. Only the files parsed with another grammar
+//  (the templates) are entered in the parsing cache: the configuration files of the command line
+//  and the files they include are parsed once per run, keeping their tokens would only use memory.
+//--------------------------------------------------------------------------------------------------
+
+static const int32_t * gCommandLineProductionArray = nullptr ;
+
 //--------------------------------------------------------------------------------------------------
 
 bool Lexique::performTopDownParsing (const int32_t * inProductionArray,
@@ -338,6 +347,63 @@ bool Lexique::performTopDownParsing (const int32_t * inProductionArray,
                                      const int32_t * inDecisionTableArray,
                                      const int32_t * inDecisionTableIndexArray,
                                      const int32_t inProgramCounterInitialValue) {
+  if (mGenerationIsUpToDate) { // See GenerationManifest::beginSourceFile
+    return false ;
+  }
+//--- Templates and included files parsed while a command line source file is handled
+  const ProfilerSection section ("source file", sourceFilePath (), ! handlesCommandLineSourceFile ()) ;
+  bool result = false ;
+  if (handlesCommandLineSourceFile ()) {
+    gCommandLineProductionArray = inProductionArray ;
+  }
+//--- The parsing cache is only used for templates, in the normal execution mode
+  const bool useParsingCache = (sourceFilePath ().length () > 0)
+    && (inProductionArray != gCommandLineProductionArray)
+    && ! executionModeIsLexicalAnalysisOnly ()
+    && ! executionModeIsSyntaxAnalysisOnly ()
+    && ! executionModeIsIndexing ()
+    && ! executionModeIsLatex ()
+    && ! gOption_galgas_5F_builtin_5F_options_outputConcreteSyntaxTree.mValue ;
+  if (useParsingCache) {
+    mParsingCacheEntry = ParsingCache::find (sourceFilePath (), inProductionArray, sourceText ().sourceString ()) ;
+  }
+  if (mParsingCacheEntry != nullptr) {
+  //--- Same text already parsed with this grammar: the first pass is not performed again
+    mFirstToken = mParsingCacheEntry->mFirstToken ;
+    mLastToken = mParsingCacheEntry->mLastToken ;
+    mParsingCacheEntry->mDecisions.copyTo (mArrayForSecondPassParsing) ;
+    resetForSecondPass () ;
+    result = true ;
+  }else{
+    const int32_t issueCount = totalErrorCount () + totalWarningCount () ;
+    result = performFirstPassOfTopDownParsing (inProductionArray,
+                                               inProductionNameArray,
+                                               inProductionIndexArray,
+                                               inFirstProductionIndexArray,
+                                               inDecisionTableArray,
+                                               inDecisionTableIndexArray,
+                                               inProgramCounterInitialValue) ;
+  //--- A parse without any error or warning is entered in the cache, that owns the token list from now
+    if (useParsingCache && result && (issueCount == (totalErrorCount () + totalWarningCount ()))) {
+      mParsingCacheEntry = ParsingCache::enter (sourceFilePath (), inProductionArray, sourceText ().sourceString (),
+                                                mFirstToken, mLastToken, mArrayForSecondPassParsing) ;
+    }
+  }
+  if (handlesCommandLineSourceFile ()) {
+    Profiler::endParsing () ;
+  }
+  return result ;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+bool Lexique::performFirstPassOfTopDownParsing (const int32_t * inProductionArray,
+                                                const cProductionNameDescriptor * inProductionNameArray,
+                                                const int32_t * inProductionIndexArray,
+                                                const int32_t * inFirstProductionIndexArray,
+                                                const int32_t * inDecisionTableArray,
+                                                const int32_t * inDecisionTableIndexArray,
+                                                const int32_t inProgramCounterInitialValue) {
   bool result = false ;
 //--- Lexical analysis
   performLexicalAnalysis () ;
@@ -25,7 +25,10 @@
 #include "unicode_character_cpp.h"
 #include "C_galgas_CLI_Options.h"
 #include "cIndexingDictionary.h"
+#include "C_galgas_io.h"
 #include "FileManager.h"
+#include "GenerationManifest.h"
+#include "Profiler.h"
 #include "F_verbose_output.h"
 
 //--------------------------------------------------------------------------------------------------
@@ -74,10 +77,12 @@ Lexique::Lexique (Compiler * inCallerCompiler,
                   const String & inSourceFileName
                   COMMA_LOCATION_ARGS) :
 Compiler (inCallerCompiler COMMA_THERE),
+mGenerationIsUpToDate (false),
 mIndexingDictionary (nullptr),
 mFirstToken (nullptr),
 mLastToken (nullptr),
 mCurrentTokenPtr (nullptr),
+mParsingCacheEntry (),
 mLastSeparatorIndex (0),
 mCurrentChar (TO_UNICODE ('\0')),
 mPreviousChar (TO_UNICODE ('\0')),
@@ -92,6 +97,13 @@ mLatexOutputString (),
 mLatexNextCharacterToEnterIndex (0) {
 //---
   if (inSourceFileName.length () > 0) {
+    if (handlesCommandLineSourceFile ()) {
+      mGenerationIsUpToDate = GenerationManifest::beginSourceFile (inSourceFileName) ;
+      if (mGenerationIsUpToDate && verboseOutput ()) {
+        ggs_printMessage (String ("'") + inSourceFileName + "' is up to date.\n" COMMA_HERE) ;
+      }
+      Profiler::beginSourceFile () ;
+    }
     logFileRead (inSourceFileName) ;
     bool ok = false ;
     PMTextFileEncoding textFileEncoding ;
@@ -120,10 +132,12 @@ Lexique::Lexique (Compiler * inCallerCompiler,
                   const String & inStringForError
                   COMMA_LOCATION_ARGS) :
 Compiler (inCallerCompiler COMMA_THERE),
+mGenerationIsUpToDate (false),
 mIndexingDictionary (nullptr),
 mFirstToken (nullptr),
 mLastToken (nullptr),
 mCurrentTokenPtr (nullptr),
+mParsingCacheEntry (),
 mLastSeparatorIndex (0),
 mCurrentChar (TO_UNICODE ('\0')),
 mPreviousChar (TO_UNICODE ('\0')),
@@ -145,10 +159,31 @@ mLatexNextCharacterToEnterIndex (0) {
 
 //--------------------------------------------------------------------------------------------------
 
+bool Lexique::handlesCommandLineSourceFile (void) const {
+  return (mCallerCompiler != nullptr) && (mCallerCompiler->callerCompiler () == nullptr) ;
+}
+
+//--------------------------------------------------------------------------------------------------
+
 Lexique::~Lexique (void) {
+//--- The files written for a source file of the command line are reported before the main routine
+//    tests the error count, and before the manifest is written; the profile includes their write
+//    time. A destructor cannot throw: reaching the maximum error count is ignored here, and is
+//    raised again by the next error.
+  if (handlesCommandLineSourceFile ()) {
+    try{
+      reportEnqueuedFileWrites (HERE) ;
+      Profiler::endSourceFile (sourceFilePath (), this COMMA_HERE) ;
+    }catch (const max_error_count_reached_exception &) {
+    }
+    GenerationManifest::endSourceFile (sourceFilePath ()) ;
+  }
   macroMyDelete (mIndexingDictionary) ;
   mLastToken = nullptr ;
   mCurrentTokenPtr = nullptr ;
+  if (mParsingCacheEntry != nullptr) { // The token list is owned by the parsing cache
+    mFirstToken = nullptr ;
+  }
   while (mFirstToken != nullptr) {
     cToken * p = mFirstToken->mNextToken ;
     macroMyDelete (mFirstToken) ;
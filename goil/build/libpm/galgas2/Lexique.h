@@ -27,6 +27,7 @@
 #include "cProductionNameDescriptor.h"
 #include "cTemplateDelimiter.h"
 #include "C_galgas_io.h"
+#include "ParsingCache.h"
 
 //--------------------------------------------------------------------------------------------------
 
@@ -75,6 +76,10 @@ class Lexique : public Compiler {
   private: Lexique (const Lexique &) = delete ;
   private: Lexique & operator = (const Lexique &) = delete ;
 
+//--- Source file given on the command line (the caller is the compiler of the main routine)
+  private: bool handlesCommandLineSourceFile (void) const ;
+  private: bool mGenerationIsUpToDate ; // --incremental option: nothing to parse
+
 //--- Indexing
   public: void enterIndexing (const uint32_t inIndexingKind,
                               const char * inIndexedKeyPosfix) ;
@@ -90,6 +95,7 @@ class Lexique : public Compiler {
   private: cToken * mFirstToken ;
   private: cToken * mLastToken ;
   private: cToken * mCurrentTokenPtr ;
+  private: std::shared_ptr <ParsingCacheEntry> mParsingCacheEntry ; // Owner of the token list, if any
   protected: void enterTokenFromPointer (cToken * inToken) ;
   private: int32_t mLastSeparatorIndex ;
   public: void appendLastSeparatorTo (String & ioString) const ;
@@ -205,6 +211,15 @@ class Lexique : public Compiler {
                                       const int32_t * inDecisionTableIndexArray,
                                       const int32_t inProgramCounterInitialValue) ;
 
+//--- Lexical analysis and LL (1) parsing, that builds the token list and the decisions array
+  private: bool performFirstPassOfTopDownParsing (const int32_t * inProductionArray,
+                                                  const cProductionNameDescriptor * inProductionNameArray,
+                                                  const int32_t * inProductionIndexnArray,
+                                                  const int32_t * inFirstProductionIndexArray,
+                                                  const int32_t * inDecisionTableArray,
+                                                  const int32_t * inDecisionTableIndexArray,
+                                                  const int32_t inProgramCounterInitialValue) ;
+
   private: void buildExpectedTerminalsArrayOnSyntaxError (const int32_t inErrorProgramCounter,
                                                           const int32_t inErrorStackCount,
                                                           const TC_Array <int32_t> & inCurrentStack,
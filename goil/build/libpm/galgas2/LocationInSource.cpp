@@ -34,8 +34,8 @@ mSourceText () {
 //--------------------------------------------------------------------------------------------------
 
 void LocationInSource::gotoNextLocation (void) {
-  if (mIndex < mSourceText.sourceString ().length ()) {
-    const utf32 currentChar = mSourceText.sourceString ().charAtIndex (mIndex COMMA_HERE) ;
+  if (mIndex < mSourceText.sourceLength ()) {
+    const utf32 currentChar = mSourceText.readCharOrNul (mIndex COMMA_HERE) ;
     const bool previousCharWasEndOfLine = UNICODE_VALUE (currentChar) == '\n' ;
     if (previousCharWasEndOfLine) {
       mLineNumber ++ ;
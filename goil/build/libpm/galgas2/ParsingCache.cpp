@@ -0,0 +1,99 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  ParsingCache : token lists and parsing decisions of the templates parsed in a run
+//
+//  This file is part of libpm library
+//
+//  This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+//  Public License as published by the Free Software Foundation; either version 2 of the License, or (at your option)
+//  any later version.
+//
+//  This program is distributed in the hope it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//  warranty of MERCHANDIBILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+//  more details.
+//
+//--------------------------------------------------------------------------------------------------
+
+#include "ParsingCache.h"
+#include "C_galgas_io.h"
+#include "PrologueEpilogue.h"
+#include "MF_MemoryControl.h"
+
+//--------------------------------------------------------------------------------------------------
+
+#include <map>
+#include <string>
+
+//--------------------------------------------------------------------------------------------------
+
+ParsingCacheEntry::ParsingCacheEntry (const String & inSourceString,
+                                      cToken * inFirstToken,
+                                      cToken * inLastToken,
+                                      const TC_UniqueArray <int32_t> & inDecisions) :
+mSourceString (inSourceString),
+mFirstToken (inFirstToken),
+mLastToken (inLastToken),
+mDecisions () {
+  inDecisions.copyTo (mDecisions) ;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+ParsingCacheEntry::~ ParsingCacheEntry (void) {
+  cToken * token = mFirstToken ;
+  while (token != nullptr) {
+    cToken * p = token->mNextToken ;
+    macroMyDelete (token) ;
+    token = p ;
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+//  Key: source file path, production array of the grammar
+//--------------------------------------------------------------------------------------------------
+
+typedef std::pair <std::string, const int32_t *> cParsingCacheKey ;
+
+static std::map <cParsingCacheKey, std::shared_ptr <ParsingCacheEntry> > gParsingCache ;
+
+//--------------------------------------------------------------------------------------------------
+
+void ParsingCache::release (void) {
+  gParsingCache.clear () ;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+PrologueEpilogue gEpilogueForParsingCache (nullptr, ParsingCache::release) ;
+
+//--------------------------------------------------------------------------------------------------
+
+std::shared_ptr <ParsingCacheEntry> ParsingCache::find (const String & inSourceFilePath,
+                                                        const int32_t * inProductionArray,
+                                                        const String & inSourceString) {
+  std::shared_ptr <ParsingCacheEntry> result ;
+  const cParsingCacheKey key (inSourceFilePath.cString (), inProductionArray) ;
+  const auto it = gParsingCache.find (key) ;
+  if ((it != gParsingCache.end ()) && (it->second->mSourceString == inSourceString)) {
+    result = it->second ;
+  }
+  return result ;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+std::shared_ptr <ParsingCacheEntry> ParsingCache::enter (const String & inSourceFilePath,
+                                                         const int32_t * inProductionArray,
+                                                         const String & inSourceString,
+                                                         cToken * inFirstToken,
+                                                         cToken * inLastToken,
+                                                         const TC_UniqueArray <int32_t> & inDecisions) {
+  const std::shared_ptr <ParsingCacheEntry> result = std::make_shared <ParsingCacheEntry> (
+    inSourceString, inFirstToken, inLastToken, inDecisions
+  ) ;
+//--- The previous entry of the path, if any, is released when no lexique uses it any more
+  gParsingCache [cParsingCacheKey (inSourceFilePath.cString (), inProductionArray)] = result ;
+  return result ;
+}
+
+//--------------------------------------------------------------------------------------------------
@@ -0,0 +1,87 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  ParsingCache : token lists and parsing decisions of the templates parsed in a run
+//
+//  This file is part of libpm library
+//
+//  This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+//  Public License as published by the Free Software Foundation; either version 2 of the License, or (at your option)
+//  any later version.
+//
+//  This program is distributed in the hope it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//  warranty of MERCHANDIBILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+//  more details.
+//
+//--------------------------------------------------------------------------------------------------
+
+#pragma once
+
+//--------------------------------------------------------------------------------------------------
+
+#include "String-class.h"
+#include "TC_UniqueArray.h"
+
+//--------------------------------------------------------------------------------------------------
+
+#include <memory>
+
+//--------------------------------------------------------------------------------------------------
+
+class cToken ;
+
+//--------------------------------------------------------------------------------------------------
+//
+//  A top-down parse is done in two passes: the first one builds the token list and the array of
+//  the decisions taken by the LL(1) parser, the second one runs the semantic actions. When a
+//  template is parsed again with the same text (a template invoked by several GTL invocations),
+//  the first pass is replaced by the cached token list and decisions; the semantic actions
+//  always run. The source files of the command line, and the files parsed with their grammar,
+//  are not cached (see Lexique::performTopDownParsing).
+//
+//  There is one entry for a given source path and grammar: parsing a changed text replaces it.
+//  Entries are shared with the lexiques that use them. The cache lives in memory only and only
+//  helps within one run: it is not saved between runs, and a server started with --serve
+//  releases it after each command.
+//
+//--------------------------------------------------------------------------------------------------
+
+class ParsingCacheEntry final {
+  public: const String mSourceString ;
+  public: cToken * const mFirstToken ;
+  public: cToken * const mLastToken ;
+  public: TC_UniqueArray <int32_t> mDecisions ;
+
+  public: ParsingCacheEntry (const String & inSourceString,
+                             cToken * inFirstToken,
+                             cToken * inLastToken,
+                             const TC_UniqueArray <int32_t> & inDecisions) ;
+
+//--- The token list is released
+  public: ~ ParsingCacheEntry (void) ;
+
+//--- No copy
+  private: ParsingCacheEntry (const ParsingCacheEntry &) = delete ;
+  private: ParsingCacheEntry & operator = (const ParsingCacheEntry &) = delete ;
+} ;
+
+//--------------------------------------------------------------------------------------------------
+
+class ParsingCache final {
+//--- Returns the entry of the source path for the grammar if it has been built from the same text
+  public: static std::shared_ptr <ParsingCacheEntry> find (const String & inSourceFilePath,
+                                                           const int32_t * inProductionArray,
+                                                           const String & inSourceString) ;
+
+//--- Enters a token list (now owned by the returned entry) and its decisions
+  public: static std::shared_ptr <ParsingCacheEntry> enter (const String & inSourceFilePath,
+                                                            const int32_t * inProductionArray,
+                                                            const String & inSourceString,
+                                                            cToken * inFirstToken,
+                                                            cToken * inLastToken,
+                                                            const TC_UniqueArray <int32_t> & inDecisions) ;
+
+//--- Removes every entry (an entry is released when no lexique uses it any more)
+  public: static void release (void) ;
+} ;
+
+//--------------------------------------------------------------------------------------------------
@@ -0,0 +1,367 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  Profiler : wall time and allocation count of the phases of a run
+//
+//  This file is part of libpm library
+//
+//  This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+//  Public License as published by the Free Software Foundation; either version 2 of the License, or (at your option)
+//  any later version.
+//
+//  This program is distributed in the hope it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//  warranty of MERCHANDIBILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+//  more details.
+//
+//--------------------------------------------------------------------------------------------------
+
+#include "Profiler.h"
+#include "Compiler.h"
+#include "C_galgas_io.h"
+#include "C_galgas_CLI_Options.h"
+#include "FileManager.h"
+#include "basic-allocation.h"
+
+//--------------------------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <string>
+#include <vector>
+#include <stdio.h>
+
+//--------------------------------------------------------------------------------------------------
+//  Section names are kept as std::string, so that nothing is left to the memory checker when the
+//  tool exits.
+//--------------------------------------------------------------------------------------------------
+
+typedef std::chrono::steady_clock::time_point cProfilerTime ;
+
+//--------------------------------------------------------------------------------------------------
+
+class cSectionStats final {
+  public: uint32_t mIndex = 0 ; // Order of first entry
+  public: uint32_t mRunningCount = 0 ;
+  public: uint64_t mCalls = 0 ;
+  public: uint64_t mTotalMicroseconds = 0 ;
+  public: uint64_t mSelfMicroseconds = 0 ;
+  public: uint64_t mTotalAllocations = 0 ;
+  public: uint64_t mSelfAllocations = 0 ;
+} ;
+
+//--------------------------------------------------------------------------------------------------
+
+typedef std::pair <std::string, std::string> cSectionKey ; // kind, name
+
+//--------------------------------------------------------------------------------------------------
+
+class cRunningSection final {
+  public: cSectionStats * mStats ;
+  public: cProfilerTime mStart ;
+  public: uint64_t mStartAllocations ;
+  public: uint64_t mNestedMicroseconds ;
+  public: uint64_t mNestedAllocations ;
+
+  public: cRunningSection (cSectionStats * inStats) :
+  mStats (inStats),
+  mStart (std::chrono::steady_clock::now ()),
+  mStartAllocations (allocatedBlockCount ()),
+  mNestedMicroseconds (0),
+  mNestedAllocations (0) {
+  }
+} ;
+
+//--------------------------------------------------------------------------------------------------
+
+static bool gRunning = false ;
+static std::map <cSectionKey, cSectionStats> gSections ;
+static std::vector <cRunningSection> gRunningSections ;
+
+//--------------------------------------------------------------------------------------------------
+
+void Profiler::start (void) {
+  gSections.clear () ;
+  gRunningSections.clear () ;
+  gRunning = true ;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void Profiler::stop (void) {
+  while (gRunningSections.size () > 0) {
+    exitSection () ;
+  }
+  gRunning = false ;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+bool Profiler::isRunning (void) {
+  return gRunning ;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void Profiler::beginSourceFile (void) {
+  if (gOption_galgas_5F_builtin_5F_options_profile.mValue) {
+    start () ;
+    enterSection ("phase", "parsing") ;
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void Profiler::endParsing (void) {
+  if (gRunning) {
+    exitSection () ;
+    enterSection ("phase", "semantic analysis and generation") ;
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void Profiler::endSourceFile (const String & inSourceFilePath,
+                              Compiler * inCompiler
+                              COMMA_LOCATION_ARGS) {
+  if (gRunning) {
+    exitSection () ;
+    uint32_t writtenFileCount = 0 ;
+    uint64_t writeMicroseconds = 0 ;
+    FileManager::takeEnqueuedWriteTime (writtenFileCount, writeMicroseconds) ;
+    addMeasuredSection ("phase", "file output", writtenFileCount, writeMicroseconds) ;
+    const String title = inSourceFilePath.lastPathComponent () ;
+    const String json = jsonReport (title) ;
+    ggs_printMessage (textReport (title) COMMA_THERE) ;
+    const String jsonFilePath = inSourceFilePath.stringByDeletingLastPathComponent ()
+      .stringByAppendingPathComponent ("build")
+      .stringByAppendingPathComponent (title + ".profile.json") ;
+    if (! FileManager::writeStringToFile (json, jsonFilePath)) {
+      inCompiler->onTheFlyRunTimeError (String ("cannot write '") + jsonFilePath + "' file" COMMA_THERE) ;
+    }
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+
+static cSectionStats & sectionStats (const char * inKind, const String & inName) {
+  const cSectionKey key (inKind, inName.cString ()) ;
+  std::map <cSectionKey, cSectionStats>::iterator it = gSections.find (key) ;
+  if (it == gSections.end ()) {
+    cSectionStats stats ;
+    stats.mIndex = uint32_t (gSections.size ()) ;
+    it = gSections.insert (std::pair <cSectionKey, cSectionStats> (key, stats)).first ;
+  }
+  return it->second ;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void Profiler::enterSection (const char * inKind, const String & inName) {
+  if (gRunning) {
+    cSectionStats & stats = sectionStats (inKind, inName) ;
+    stats.mCalls += 1 ;
+    stats.mRunningCount += 1 ;
+    gRunningSections.push_back (cRunningSection (& stats)) ;
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void Profiler::exitSection (void) {
+  if (gRunningSections.size () > 0) {
+    const cRunningSection & section = gRunningSections.back () ;
+    const uint64_t microseconds = uint64_t (std::chrono::duration_cast <std::chrono::microseconds> (
+      std::chrono::steady_clock::now () - section.mStart
+    ).count ()) ;
+    const uint64_t allocations = allocatedBlockCount () - section.mStartAllocations ;
+    cSectionStats & stats = * section.mStats ;
+    stats.mRunningCount -= 1 ;
+    if (stats.mRunningCount == 0) {
+      stats.mTotalMicroseconds += microseconds ;
+      stats.mTotalAllocations += allocations ;
+    }
+    stats.mSelfMicroseconds += microseconds - section.mNestedMicroseconds ;
+    stats.mSelfAllocations += allocations - section.mNestedAllocations ;
+    gRunningSections.pop_back () ;
+    if (gRunningSections.size () > 0) {
+      gRunningSections.back ().mNestedMicroseconds += microseconds ;
+      gRunningSections.back ().mNestedAllocations += allocations ;
+    }
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void Profiler::addMeasuredSection (const char * inKind,
+                                   const String & inName,
+                                   const uint64_t inCalls,
+                                   const uint64_t inMicroseconds) {
+  if (gRunning) {
+    cSectionStats & stats = sectionStats (inKind, inName) ;
+    stats.mCalls += inCalls ;
+    stats.mTotalMicroseconds += inMicroseconds ;
+    stats.mSelfMicroseconds += inMicroseconds ;
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+
+typedef std::map <cSectionKey, cSectionStats>::const_iterator cSectionIterator ;
+
+//--------------------------------------------------------------------------------------------------
+
+static bool reportOrder (const cSectionIterator & inLeft, const cSectionIterator & inRight) {
+  bool result ;
+  if (inLeft->first.first != inRight->first.first) {
+    if (inLeft->first.first == "phase") {
+      result = true ;
+    }else if (inRight->first.first == "phase") {
+      result = false ;
+    }else{
+      result = inLeft->first.first < inRight->first.first ;
+    }
+  }else if (inLeft->first.first == "phase") {
+    result = inLeft->second.mIndex < inRight->second.mIndex ;
+  }else if (inLeft->second.mSelfMicroseconds != inRight->second.mSelfMicroseconds) {
+    result = inLeft->second.mSelfMicroseconds > inRight->second.mSelfMicroseconds ;
+  }else{
+    result = inLeft->second.mIndex < inRight->second.mIndex ;
+  }
+  return result ;
+}
+
+//--------------------------------------------------------------------------------------------------
+//  Indexes are sorted: with the global swap of TF_Swap.h, sorting the iterators is ambiguous
+//--------------------------------------------------------------------------------------------------
+
+static std::vector <cSectionIterator> sectionsInReportOrder (void) {
+  std::vector <cSectionIterator> sections ;
+  std::vector <size_t> order ;
+  for (cSectionIterator it = gSections.begin () ; it != gSections.end () ; it++) {
+    order.push_back (sections.size ()) ;
+    sections.push_back (it) ;
+  }
+  std::sort (order.begin (), order.end (), [& sections] (const size_t inLeft, const size_t inRight) {
+    return reportOrder (sections [inLeft], sections [inRight]) ;
+  }) ;
+  std::vector <cSectionIterator> result ;
+  for (size_t i=0 ; i<order.size () ; i++) {
+    result.push_back (sections [order [i]]) ;
+  }
+  return result ;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+static void appendMilliseconds (String & ioString, const uint64_t inMicroseconds, const int inWidth) {
+  char s [32] ;
+  snprintf (s, sizeof (s), "%*.3f", inWidth, double (inMicroseconds) / 1000.0) ;
+  ioString.appendCString (s) ;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+static void appendCount (String & ioString, const uint64_t inCount, const int inWidth) {
+  char s [32] ;
+  snprintf (s, sizeof (s), "%*llu", inWidth, (unsigned long long) inCount) ;
+  ioString.appendCString (s) ;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+String Profiler::textReport (const String & inTitle) {
+  stop () ;
+  String s ;
+  s.appendCString ("Profile of '") ;
+  s.appendString (inTitle) ;
+  s.appendCString ("' (wall time in ms, allocations are blocks allocated by the main thread)\n") ;
+  s.appendCString ("kind              calls    total ms     self ms  total alloc   self alloc  name\n") ;
+  const std::vector <cSectionIterator> sections = sectionsInReportOrder () ;
+  for (size_t i=0 ; i<sections.size () ; i++) {
+    const cSectionIterator it = sections [i] ;
+    char kind [32] ;
+    snprintf (kind, sizeof (kind), "%-12.12s", it->first.first.c_str ()) ;
+    s.appendCString (kind) ;
+    appendCount (s, it->second.mCalls, 11) ;
+    appendMilliseconds (s, it->second.mTotalMicroseconds, 12) ;
+    appendMilliseconds (s, it->second.mSelfMicroseconds, 12) ;
+    appendCount (s, it->second.mTotalAllocations, 13) ;
+    appendCount (s, it->second.mSelfAllocations, 13) ;
+    s.appendCString ("  ") ;
+    s.appendCString (it->first.second.c_str ()) ;
+    s.appendCString ("\n") ;
+  }
+  return s ;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+static void appendJSONString (String & ioString, const std::string & inString) {
+  std::string s = "\"" ;
+  for (size_t i=0 ; i<inString.size () ; i++) {
+    const char c = inString [i] ;
+    if ((c == '"') || (c == '\\')) {
+      s += '\\' ;
+      s += c ;
+    }else if ((c >= 0) && (c < ' ')) {
+      char escape [8] ;
+      snprintf (escape, sizeof (escape), "\\u%04x", int (c)) ;
+      s += escape ;
+    }else{
+      s += c ;
+    }
+  }
+  s += "\"" ;
+  ioString.appendCString (s.c_str ()) ;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+String Profiler::jsonReport (const String & inTitle) {
+  stop () ;
+  String s ;
+  s.appendCString ("{\n  \"title\" : ") ;
+  appendJSONString (s, inTitle.cString ()) ;
+  s.appendCString (",\n  \"sections\" : [") ;
+  const std::vector <cSectionIterator> sections = sectionsInReportOrder () ;
+  for (size_t i=0 ; i<sections.size () ; i++) {
+    const cSectionIterator it = sections [i] ;
+    s.appendCString ((i == 0) ? "\n    {" : ",\n    {") ;
+    s.appendCString ("\"kind\" : ") ;
+    appendJSONString (s, it->first.first) ;
+    s.appendCString (", \"name\" : ") ;
+    appendJSONString (s, it->first.second) ;
+    s.appendCString (", \"calls\" : ") ;
+    appendCount (s, it->second.mCalls, 0) ;
+    s.appendCString (", \"totalMs\" : ") ;
+    appendMilliseconds (s, it->second.mTotalMicroseconds, 0) ;
+    s.appendCString (", \"selfMs\" : ") ;
+    appendMilliseconds (s, it->second.mSelfMicroseconds, 0) ;
+    s.appendCString (", \"totalAllocations\" : ") ;
+    appendCount (s, it->second.mTotalAllocations, 0) ;
+    s.appendCString (", \"selfAllocations\" : ") ;
+    appendCount (s, it->second.mSelfAllocations, 0) ;
+    s.appendCString ("}") ;
+  }
+  s.appendCString ("\n  ]\n}\n") ;
+  return s ;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+ProfilerSection::ProfilerSection (const char * inKind, const String & inName, const bool inEnter) :
+mEntered (inEnter && Profiler::isRunning ()) {
+  if (mEntered) {
+    Profiler::enterSection (inKind, inName) ;
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+
+ProfilerSection::~ ProfilerSection (void) {
+  if (mEntered) {
+    Profiler::exitSection () ;
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
@@ -0,0 +1,88 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  Profiler : wall time and allocation count of the phases of a run
+//
+//  This file is part of libpm library
+//
+//  This library is free software; you can redistribute it and/or modify it under the terms of the GNU Lesser General
+//  Public License as published by the Free Software Foundation; either version 2 of the License, or (at your option)
+//  any later version.
+//
+//  This program is distributed in the hope it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+//  warranty of MERCHANDIBILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+//  more details.
+//
+//--------------------------------------------------------------------------------------------------
+
+#pragma once
+
+//--------------------------------------------------------------------------------------------------
+
+#include "String-class.h"
+#include "M_SourceLocation.h"
+
+//--------------------------------------------------------------------------------------------------
+
+class Compiler ;
+
+//--------------------------------------------------------------------------------------------------
+//
+//  While the profiler is running, every section (a phase, a template, a function, ...) entered by
+//  the main thread is accumulated under its kind and its name: number of calls, wall time and
+//  number of blocks allocated (see allocatedBlockCount), both including the nested sections
+//  (total) and excluding them (self). A section that is entered again while it is running
+//  (a recursive template) is counted once in the totals.
+//
+//  Sections do nothing while the profiler is stopped, so instrumented code has no cost beyond a
+//  test when profiling is not required.
+//
+//--------------------------------------------------------------------------------------------------
+
+class Profiler final {
+//--- Start discards the sections of a previous run
+  public: static void start (void) ;
+  public: static void stop (void) ;
+  public: static bool isRunning (void) ;
+
+//--- --profile option: Lexique calls beginSourceFile and endSourceFile for every source file given
+//    on the command line, and endParsing when its first parsing pass is done. The phases are
+//    "parsing", "semantic analysis and generation" and "file output" (the time the file writer
+//    threads have spent writing). endSourceFile prints the text report, and writes the JSON
+//    report to build/<source file name>.profile.json, next to the source file.
+  public: static void beginSourceFile (void) ;
+  public: static void endParsing (void) ;
+  public: static void endSourceFile (const String & inSourceFilePath,
+                                     Compiler * inCompiler
+                                     COMMA_LOCATION_ARGS) ;
+
+  public: static void enterSection (const char * inKind, const String & inName) ;
+  public: static void exitSection (void) ;
+
+//--- Work measured by other threads (file writing): added to the section, not to the running ones
+  public: static void addMeasuredSection (const char * inKind,
+                                          const String & inName,
+                                          const uint64_t inCalls,
+                                          const uint64_t inMicroseconds) ;
+
+//--- Reports (the profiler is stopped): the phases in the order they have been entered, then the
+//    other sections by kind, by decreasing self time.
+  public: static String textReport (const String & inTitle) ;
+  public: static String jsonReport (const String & inTitle) ;
+} ;
+
+//--------------------------------------------------------------------------------------------------
+//  A profiler section for the lifetime of the object, if inEnter is true
+//--------------------------------------------------------------------------------------------------
+
+class ProfilerSection final {
+  private: bool mEntered ;
+
+  public: ProfilerSection (const char * inKind, const String & inName, const bool inEnter = true) ;
+  public: ~ ProfilerSection (void) ;
+
+//--- No copy
+  private: ProfilerSection (const ProfilerSection &) = delete ;
+  private: ProfilerSection & operator = (const ProfilerSection &) = delete ;
+} ;
+
+//--------------------------------------------------------------------------------------------------
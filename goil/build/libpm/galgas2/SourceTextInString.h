@@ -40,11 +40,16 @@ class cSourceTextInString final : public SharedObject {
   SharedObject (THERE),
   mFilePath (inFilePath),
   mSourceString (inSourceString),
+  mSourceLength (inSourceString.length ()),
+  mSourceCharArray (inSourceString.unsafeUTF32ArrayPointer ()),
   mShowSourceOnDetailledErrorMessage (inShowSourceOnDetailledErrorMessage) {
   }
 
   public: String mFilePath ;
-  public: String mSourceString ;
+  public: const String mSourceString ;
+//--- The source string is never changed, so the scanners read its characters directly
+  public: const int32_t mSourceLength ;
+  public: const utf32 * const mSourceCharArray ;
   public: bool mShowSourceOnDetailledErrorMessage ;
 
 //--- No copy
@@ -92,11 +97,13 @@ class SourceTextInString final {
   }
 
   public: int32_t sourceLength (void) const {
-    return (mObject == nullptr) ? 0 : mObject->mSourceString.length () ;
+    return (mObject == nullptr) ? 0 : mObject->mSourceLength ;
   }
 
-  public: utf32 readCharOrNul (const int32_t inIndex COMMA_LOCATION_ARGS) const {
-    return (mObject == nullptr) ? TO_UNICODE (0) : mObject->mSourceString.readCharOrNul (inIndex COMMA_THERE) ;
+  public: inline utf32 readCharOrNul (const int32_t inIndex COMMA_UNUSED_LOCATION_ARGS) const {
+    return ((mObject == nullptr) || (inIndex >= mObject->mSourceLength))
+      ? TO_UNICODE (0)
+      : mObject->mSourceCharArray [inIndex] ;
   }
 
   public: String getLineForLocation (const class LocationInSource & inLocation) const ;
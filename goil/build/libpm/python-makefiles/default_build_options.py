@@ -93,3 +93,19 @@ def ObjectiveCpp_CompilerOptions (platformOptions):
   return result
 
 #-----------------------------------------------------------------------------------------
+#
+#     libpm sources that are not listed in the file list generated by galgas
+#     (build/output/file-list.json): they are added to every build here, so
+#     that regenerating the file list keeps them
+#
+#-----------------------------------------------------------------------------------------
+
+def additionalLibpmSources ():
+  result = []
+  result.append ("CommandServer.cpp")
+  result.append ("GenerationManifest.cpp")
+  result.append ("ParsingCache.cpp")
+  result.append ("Profiler.cpp")
+  return result
+
+#-----------------------------------------------------------------------------------------
@@ -59,6 +59,9 @@ class GenericGalgasMakefile :
     startTime = time.time ()
   #--- Source file list
     SOURCES = self.mDictionary ["SOURCES"].copy ()
+    for source in default_build_options.additionalLibpmSources () :
+      if not source in SOURCES :
+        SOURCES.append (source)
   #--- Linker options
     self.mLinkerOptions += self.mDictionary ["USER_LINK_OPTIONS"].copy ()
   #--- LIBPM
@@ -892,6 +892,9 @@ int32_t String::compareWithCString (const char * const inCString) const {
 //--------------------------------------------------------------------------------------------------
 
 int32_t String::compare (const String & inString) const {
+  if (mEmbeddedString == inString.mEmbeddedString) { // Same storage (copies, interned strings)
+    return 0 ;
+  }
   int32_t result = 0 ;
   const int32_t minLength = std::min (length (), inString.length ()) ;
   for (int32_t i=0 ; (i < minLength) && (result == 0) ; i++) {
@@ -23,12 +23,14 @@
 #include "SharedObject.h"
 #include "unicode_character_cpp.h"
 #include "TC_UniqueArray2.h"
+#include "PrologueEpilogue.h"
 
 //--------------------------------------------------------------------------------------------------
 
 #include <math.h>
 #include <string.h>
 #include <ctype.h>
+#include <unordered_set>
 
 //--------------------------------------------------------------------------------------------------
 
@@ -41,6 +43,8 @@
 class PrivateEmbeddedString final : public SharedObject {
   private: TC_UniqueArray <utf32> mCharArray ;
   private: char * mUTF8CString ; // Zero terminated string
+  private: mutable uint32_t mHashValue ; // Valid if mHashValueIsValid
+  private: mutable bool mHashValueIsValid ;
 
   public: PrivateEmbeddedString (const int32_t inCapacity COMMA_LOCATION_ARGS) ;
 
@@ -55,6 +59,8 @@ class PrivateEmbeddedString final : public SharedObject {
 
   public: int32_t length (void) const { return mCharArray.count () ; }
 
+  public: const utf32 * unsafeArrayPointer (void) const { return mCharArray.unsafeArrayPointer () ; }
+
   public: utf32 charAtIndex (const int32_t inIndex COMMA_LOCATION_ARGS) const ;
 
   public: utf32 lastChar (LOCATION_ARGS) const { return mCharArray.lastObject (THERE) ; }
@@ -65,12 +71,16 @@ class PrivateEmbeddedString final : public SharedObject {
 
   public: void appendChar (const utf32 inChar  COMMA_LOCATION_ARGS) ;
 
+  public: void appendASCIIChars (const uint8_t * inChars, const int32_t inCount) ;
+
   public: void removeCountFromIndex (const int32_t inCount,
                                      const int32_t inIndex
                                      COMMA_LOCATION_ARGS) ;
 
   public: const char * cString (void) ;
 
+  public: uint32_t hashValue (void) const ;
+
   public: void reallocEmbeddedString (const int32_t inCapacity) ;
 
   public: void removeAllKeepingCapacity (void) ;
@@ -100,7 +110,9 @@ static int32_t stringGoodSize (const int32_t inCurrentCapacity,
 PrivateEmbeddedString::PrivateEmbeddedString (const int32_t inCapacity COMMA_LOCATION_ARGS) :
 SharedObject (THERE),
 mCharArray (inCapacity COMMA_THERE),
-mUTF8CString (nullptr) {
+mUTF8CString (nullptr),
+mHashValue (0),
+mHashValueIsValid (false) {
   #ifndef DO_NOT_GENERATE_CHECKINGS
     checkEmbeddedString (HERE) ;
   #endif
@@ -113,7 +125,9 @@ PrivateEmbeddedString::PrivateEmbeddedString (const PrivateEmbeddedString * inEm
                                               COMMA_LOCATION_ARGS) :
 SharedObject (THERE),
 mCharArray (stringGoodSize (inEmbeddedString->capacity (), inCapacity) COMMA_THERE),
-mUTF8CString (nullptr) {
+mUTF8CString (nullptr),
+mHashValue (0),
+mHashValueIsValid (false) {
   macroValidPointer (inEmbeddedString) ;
   for (int32_t i=0 ; i<int32_t (inEmbeddedString->length ()) ; i++) {
     appendChar (inEmbeddedString->charAtIndex (i COMMA_HERE) COMMA_HERE) ;
@@ -142,6 +156,7 @@ void PrivateEmbeddedString::setCharAtIndex (const utf32 inChar,
                                             COMMA_LOCATION_ARGS) {
   macroUniqueSharedObjectThere (this) ;
   macroMyDeletePODArray (mUTF8CString) ;
+  mHashValueIsValid = false ;
   mCharArray (inIndex COMMA_THERE) = inChar ;
 }
 
@@ -152,6 +167,7 @@ void PrivateEmbeddedString::insertCharAtIndex (const utf32 inChar,
                                                COMMA_LOCATION_ARGS) {
   macroUniqueSharedObjectThere (this) ;
   macroMyDeletePODArray (mUTF8CString) ;
+  mHashValueIsValid = false ;
   mCharArray.insertObjectAtIndex (inChar, inIndex COMMA_THERE) ;
 }
 
@@ -160,16 +176,29 @@ void PrivateEmbeddedString::insertCharAtIndex (const utf32 inChar,
 void PrivateEmbeddedString::appendChar (const utf32 inChar COMMA_LOCATION_ARGS) {
   macroUniqueSharedObjectThere (this) ;
   macroMyDeletePODArray (mUTF8CString) ;
+  mHashValueIsValid = false ;
   mCharArray.appendObject (inChar) ;
 }
 
 //--------------------------------------------------------------------------------------------------
 
+void PrivateEmbeddedString::appendASCIIChars (const uint8_t * inChars, const int32_t inCount) {
+  macroUniqueSharedObject (this) ;
+  macroMyDeletePODArray (mUTF8CString) ;
+  mHashValueIsValid = false ;
+  for (int32_t i=0 ; i<inCount ; i++) {
+    mCharArray.appendObject (TO_UNICODE (inChars [i])) ;
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+
 void PrivateEmbeddedString::removeCountFromIndex (const int32_t inCount,
                                                   const int32_t inStartIndex
                                                   COMMA_LOCATION_ARGS) {
   macroUniqueSharedObjectThere (this) ;
   macroMyDeletePODArray (mUTF8CString) ;
+  mHashValueIsValid = false ;
   mCharArray.removeObjectsAtIndex (inCount, inStartIndex COMMA_THERE) ;
 }
 
@@ -178,6 +207,23 @@ void PrivateEmbeddedString::removeCountFromIndex (const int32_t inCount,
 void PrivateEmbeddedString::removeAllKeepingCapacity (void) {
   mCharArray.removeAllKeepingCapacity () ;
   macroMyDeletePODArray (mUTF8CString) ;
+  mHashValueIsValid = false ;
+}
+
+//--------------------------------------------------------------------------------------------------
+//  FNV-1a on the code points, computed once until the next change
+
+uint32_t PrivateEmbeddedString::hashValue (void) const {
+  if (!mHashValueIsValid) {
+    uint32_t h = 2166136261U ;
+    for (int32_t i=0 ; i<length () ; i++) {
+      h ^= UNICODE_VALUE (mCharArray (i COMMA_HERE)) ;
+      h *= 16777619U ;
+    }
+    mHashValue = h ;
+    mHashValueIsValid = true ;
+  }
+  return mHashValue ;
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -419,6 +465,73 @@ const char * String::cString (void) const {
 
 //--------------------------------------------------------------------------------------------------
 
+const utf32 * String::unsafeUTF32ArrayPointer (void) const {
+  const utf32 * result = nullptr ;
+  if (nullptr != mEmbeddedString) {
+    macroValidSharedObject (mEmbeddedString, PrivateEmbeddedString) ;
+    result = mEmbeddedString->unsafeArrayPointer () ;
+  }
+  return result ;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+uint32_t String::hashValue (void) const {
+  uint32_t result = 2166136261U ; // FNV-1a of the empty string
+  if (nullptr != mEmbeddedString) {
+    macroValidSharedObject (mEmbeddedString, PrivateEmbeddedString) ;
+    result = mEmbeddedString->hashValue () ;
+  }
+  return result ;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+#ifdef PRAGMA_MARK_ALLOWED
+  #pragma mark Interned strings
+#endif
+
+//--------------------------------------------------------------------------------------------------
+
+class cInternedStringHash final {
+  public: size_t operator () (const String & inString) const { return inString.hashValue () ; }
+} ;
+
+//--------------------------------------------------------------------------------------------------
+
+static std::unordered_set <String, cInternedStringHash> gInternedStrings ;
+
+//--------------------------------------------------------------------------------------------------
+
+void String::releaseInternedStrings (void) {
+  gInternedStrings.clear () ;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+PrologueEpilogue gEpilogueForInternedStrings (nullptr, String::releaseInternedStrings) ;
+
+//--------------------------------------------------------------------------------------------------
+
+String String::internedString (void) const {
+  String result ;
+  if (length () > 0) {
+    const auto it = gInternedStrings.find (*this) ;
+    if (it != gInternedStrings.end ()) {
+      result = *it ;
+    }else{
+      macroMyNew (result.mEmbeddedString, PrivateEmbeddedString (length () COMMA_HERE)) ;
+      for (int32_t i=0 ; i<length () ; i++) {
+        result.mEmbeddedString->appendChar (charAtIndex (i COMMA_HERE) COMMA_HERE) ;
+      }
+      gInternedStrings.insert (result) ;
+    }
+  }
+  return result ;
+}
+
+//--------------------------------------------------------------------------------------------------
+
 #ifdef PRAGMA_MARK_ALLOWED
   #pragma mark Methods that change string
 #endif
@@ -689,15 +802,38 @@ String String::operator + (const String & inOperand) const {
 
 //--------------------------------------------------------------------------------------------------
 
+//--------------------------------------------------------------------------------------------------
+//  Returns true if the eight bytes are ASCII characters, none is NUL or CR : a word at a time
+//  test, the "has zero byte" expression is (v - 0x01...01) & ~v & 0x80...80
+
+static inline bool isPlainASCIIWord (const uint8_t * inBytes) {
+  uint64_t w ;
+  memcpy (& w, inBytes, sizeof (w)) ;
+  const uint64_t ones = UINT64_C (0x0101010101010101) ;
+  const uint64_t highBits = UINT64_C (0x8080808080808080) ;
+  const uint64_t xorCR = w ^ (ones * 0x0D) ;
+  return ((w | ((w - ones) & ~w) | ((xorCR - ones) & ~xorCR)) & highBits) == 0 ;
+}
+
+//--------------------------------------------------------------------------------------------------
+
 bool String::parseUTF8 (const U8Data & inDataString,
                         const int32_t inOffset,
                         String & outString) {
   bool ok = true ;
   int32_t idx = inOffset ;
   bool foundCR = false ;
-  while ((idx < inDataString.count ()) && ok) {
-    const uint8_t c = inDataString (idx COMMA_HERE) ;
-    if (c == 0x00) { // NUL
+  const int32_t count = inDataString.count () ;
+  const uint8_t * data = inDataString.unsafeDataPointer () ;
+  if (idx < count) { // Room for the worst case, one character per byte
+    outString.insulateEmbeddedString (outString.length () + count - idx) ;
+  }
+  while ((idx < count) && ok) {
+    const uint8_t c = data [idx] ;
+    if (!foundCR && ((idx + 8) <= count) && isPlainASCIIWord (data + idx)) {
+      outString.mEmbeddedString->appendASCIIChars (data + idx, 8) ;
+      idx += 8 ;
+    }else if (c == 0x00) { // NUL
       idx = inDataString.count () ; // For exiting loop
     }else if (c == 0x0A) { // LF
       if (! foundCR) {
@@ -163,9 +163,26 @@ class String : public AbstractOutputStream {
 //--- Get SHA256 value
   public: String sha256 (void) const ;
 
+//--- Get a hash value of the characters (not a cryptographic hash), for hash tables ; it is
+//    cached in the string storage until the next change
+  public: uint32_t hashValue (void) const ;
+
+//--- Get the interned string with the same characters : every interned copy of a given text shares
+//    one storage, allocated to the exact length, so these copies compare equal by pointer. Only
+//    map keys are interned (see cMapNode), not the strings of the scanner tokens
+  public: String internedString (void) const ;
+
+//--- Forget the interned strings (they remain valid while they are used) ; done at exit and after
+//    each command of a server started with --serve, so that the set does not grow without bound
+  public: static void releaseInternedStrings (void) ;
+
 //--- Get a string pointer
   public: const char * cString (void) const ;
 
+//--- Get a pointer to the characters (nullptr for an empty string) ; it is valid until the string is
+//    changed or released
+  public: const utf32 * unsafeUTF32ArrayPointer (void) const ;
+
 //--- Compare with an other string 
   public: int32_t compareWithCString (const char * const inCstring) const ;
   public: int32_t compare (const String & inString) const ;
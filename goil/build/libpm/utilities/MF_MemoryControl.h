@@ -24,6 +24,7 @@
 
 #include "macroAssert.h"
 #include "cpp-allocation.h"
+#include "basic-allocation.h"
 
 //--------------------------------------------------------------------------------------------------
 
@@ -115,8 +115,10 @@ void SharedObject::release (const SharedObject * inObject COMMA_LOCATION_ARGS) {
 void SharedObject::retainRelease (const SharedObject * inObjectToRetain,
                                     const SharedObject * inObjectToRelease
                                     COMMA_LOCATION_ARGS) {
-  retain (inObjectToRetain COMMA_THERE) ;
-  release (inObjectToRelease COMMA_THERE) ;
+  if (inObjectToRetain != inObjectToRelease) { // Assigning an object to itself changes nothing
+    retain (inObjectToRetain COMMA_THERE) ;
+    release (inObjectToRelease COMMA_THERE) ;
+  }
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -54,6 +54,9 @@ class SharedObject {
                                      const SharedObject * inObjectToRelease
                                      COMMA_LOCATION_ARGS) ;
 
+//--- Instances are allocated by size class (release mode)
+  macroUseSizeClassAllocation
+
 //--- Default Constructor
   protected: SharedObject (LOCATION_ARGS) ;
   
@@ -24,6 +24,8 @@
 //--------------------------------------------------------------------------------------------------
 
 #include <stdlib.h>
+#include <stdint.h>
+#include <new>
 
 //--------------------------------------------------------------------------------------------------
 
@@ -90,9 +92,20 @@
 
 //--------------------------------------------------------------------------------------------------
 
+static thread_local uint64_t gAllocatedBlockCount ;
+
+//--------------------------------------------------------------------------------------------------
+
+uint64_t allocatedBlockCount (void) {
+  return gAllocatedBlockCount ;
+}
+
+//--------------------------------------------------------------------------------------------------
+
 #ifdef USE_SMALL_BLOCK_FREE_LIST
  void * myAllocRoutine (const size_t inSizeInBytes) {
   void * ptr = nullptr ;
+  gAllocatedBlockCount += 1 ;
   if (inSizeInBytes <= (sizeof (cBlock) - sizeof (int32_t))) {
     if (gFreeList == nullptr) {
       cBlock * p = (cBlock *) ::malloc (sizeof (cBlock)) ;
@@ -117,6 +130,7 @@
 
 #ifndef USE_SMALL_BLOCK_FREE_LIST
 void * myAllocRoutine (const size_t inSizeInBytes) {
+  gAllocatedBlockCount += 1 ;
   #ifdef USE_MALLOC_GOOD_SIZE
     const size_t sizeInBytes = malloc_good_size (inSizeInBytes) ;
   #else
@@ -169,6 +183,82 @@ void myFreeRoutine (void * inPointer) {
 
 //--------------------------------------------------------------------------------------------------
 
+#ifdef PRAGMA_MARK_ALLOWED
+  #pragma mark Size class allocation
+#endif
+
+//--------------------------------------------------------------------------------------------------
+
+static const size_t kSizeClassGranularity = 16 ;
+static const size_t kSizeClassCount = 16 ; // Blocks up to 256 bytes
+static const size_t kSlabSize = 64 * 1024 ;
+
+//--------------------------------------------------------------------------------------------------
+
+typedef struct cFreeBlock {
+  struct cFreeBlock * mNext ;
+} cFreeBlock ;
+
+//--------------------------------------------------------------------------------------------------
+
+static thread_local cFreeBlock * gSizeClassFreeLists [kSizeClassCount] ;
+static thread_local uint8_t * gCurrentSlab ;
+static thread_local size_t gCurrentSlabRemainingSize ;
+
+//--------------------------------------------------------------------------------------------------
+
+static size_t sizeClassForSize (const size_t inSizeInBytes) {
+  const size_t sizeClass = (inSizeInBytes + kSizeClassGranularity - 1) / kSizeClassGranularity ;
+  return (sizeClass == 0) ? 1 : sizeClass ;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void * sizeClassAllocRoutine (const size_t inSizeInBytes) {
+  void * result = nullptr ;
+  gAllocatedBlockCount += 1 ;
+  const size_t sizeClass = sizeClassForSize (inSizeInBytes) ;
+  if (sizeClass > kSizeClassCount) {
+    result = ::malloc (inSizeInBytes) ;
+  }else if (nullptr != gSizeClassFreeLists [sizeClass - 1]) {
+    cFreeBlock * p = gSizeClassFreeLists [sizeClass - 1] ;
+    gSizeClassFreeLists [sizeClass - 1] = p->mNext ;
+    result = p ;
+  }else{
+    const size_t blockSize = sizeClass * kSizeClassGranularity ;
+    if (gCurrentSlabRemainingSize < blockSize) { // The end of the current slab is lost
+      gCurrentSlab = (uint8_t *) ::malloc (kSlabSize) ;
+      gCurrentSlabRemainingSize = (nullptr == gCurrentSlab) ? 0 : kSlabSize ;
+    }
+    if (nullptr != gCurrentSlab) {
+      result = gCurrentSlab ;
+      gCurrentSlab += blockSize ;
+      gCurrentSlabRemainingSize -= blockSize ;
+    }
+  }
+  if (nullptr == result) {
+    throw std::bad_alloc () ;
+  }
+  return result ;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void sizeClassFreeRoutine (void * inPointer, const size_t inSizeInBytes) {
+  if (nullptr != inPointer) {
+    const size_t sizeClass = sizeClassForSize (inSizeInBytes) ;
+    if (sizeClass > kSizeClassCount) {
+      ::free (inPointer) ;
+    }else{
+      cFreeBlock * p = (cFreeBlock *) inPointer ;
+      p->mNext = gSizeClassFreeLists [sizeClass - 1] ;
+      gSizeClassFreeLists [sizeClass - 1] = p ;
+    }
+  }
+}
+
+//--------------------------------------------------------------------------------------------------
+
 #ifdef PRAGMA_MARK_ALLOWED
   #pragma mark Stats about block size
 #endif
@@ -22,6 +22,11 @@
 
 //--------------------------------------------------------------------------------------------------
 
+#include <stddef.h>
+#include <stdint.h>
+
+//--------------------------------------------------------------------------------------------------
+
 void * myAllocRoutine (const size_t inSizeInBytes) ;
 
 void myFreeRoutine (void * inPointer) ;
@@ -31,3 +36,48 @@ void myFreeRoutine (void * inPointer) ;
 void displayAllocatedBlockSizeStats (void) ;
 
 //--------------------------------------------------------------------------------------------------
+//  Number of blocks allocated by the calling thread with myAllocRoutine (every C++ allocation in
+//  debug mode) and sizeClassAllocRoutine (shared objects and collection nodes in release mode).
+//--------------------------------------------------------------------------------------------------
+
+uint64_t allocatedBlockCount (void) ;
+
+//--------------------------------------------------------------------------------------------------
+//
+//  Size class allocation, for small objects that are allocated and released in great numbers
+//  (shared objects, collection nodes). Blocks up to 256 bytes are rounded up to a multiple of 16
+//  bytes and carved from 64 kB slabs; a released block goes to the free list of its size class
+//  (one set of free lists per thread) and is never given back to malloc, slabs are reclaimed with
+//  the process. Larger blocks use malloc.
+//
+//  The release must give the size of the allocation, that is what a class specific sized
+//  operator delete receives.
+//
+//  There is no arena teardown: objects are still destroyed one by one at exit, running their
+//  destructors and pushing their blocks to the free lists. Only the slabs themselves are left
+//  to the process exit.
+//
+//--------------------------------------------------------------------------------------------------
+
+void * sizeClassAllocRoutine (const size_t inSizeInBytes) ;
+
+void sizeClassFreeRoutine (void * inPointer, const size_t inSizeInBytes) ;
+
+//--------------------------------------------------------------------------------------------------
+//  Put this macro in a class declaration for allocating its instances (and the instances of its
+//  subclasses) by size class. It has no effect in debug mode, where every allocation is checked.
+//--------------------------------------------------------------------------------------------------
+
+#ifdef DO_NOT_GENERATE_CHECKINGS
+  #define macroUseSizeClassAllocation \
+    public: static void * operator new (const size_t inSizeInBytes) { \
+      return sizeClassAllocRoutine (inSizeInBytes) ; \
+    } \
+    public: static void operator delete (void * inPointer, const size_t inSizeInBytes) { \
+      sizeClassFreeRoutine (inPointer, inSizeInBytes) ; \
+    }
+#else
+  #define macroUseSizeClassAllocation
+#endif
+
+//--------------------------------------------------------------------------------------------------
@@ -760,6 +760,12 @@ C_BoolCommandLineOption gOption_goil_5F_options_arxmlDisplayOil ("goil_options",
                                          "arxmlPrintOil",
                                          "Display an Oil version while parsing an arxml file") ;
 
+C_BoolCommandLineOption gOption_goil_5F_options_arxmlStream ("goil_options",
+                                         "arxmlStream",
+                                         0,
+                                         "arxmlStream",
+                                         "Keep only the ECUC module definitions and values while parsing an arxml file, to reduce memory usage") ;
+
 C_BoolCommandLineOption gOption_goil_5F_options_warnMultiple ("goil_options",
                                          "warnMultiple",
                                          0,
@@ -8231,6 +8237,75 @@ void routine_addText_26__3F_ (GALGAS_arxmlNodeList & ioArgument_nodes,
 }
 
 
+//--------------------------------------------------------------------------------------------------
+//
+//Function 'arxmlKeepElement'
+//
+//--------------------------------------------------------------------------------------------------
+
+GALGAS_bool function_arxmlKeepElement (const GALGAS_string & constinArgument_parentPath,
+                                       const GALGAS_string & constinArgument_name,
+                                       Compiler * /* inCompiler */
+                                       COMMA_UNUSED_LOCATION_ARGS) {
+  GALGAS_bool result_keep ; // Returned variable
+  result_keep = GALGAS_bool (true) ;
+  enumGalgasBool test_0 = kBoolTrue ;
+  if (kBoolTrue == test_0) {
+    GALGAS_bool test_1 = GALGAS_bool (gOption_goil_5F_options_arxmlStream.readProperty_value ()) ;
+    if (kBoolTrue == test_1.boolEnum ()) {
+      test_1 = GALGAS_bool (kIsEqual, constinArgument_parentPath.objectCompare (GALGAS_string ("AR-PACKAGE/ELEMENTS"))) ;
+    }
+    test_0 = test_1.boolEnum () ;
+    if (kBoolTrue == test_0) {
+      GALGAS_bool test_2 = GALGAS_bool (kIsEqual, constinArgument_name.objectCompare (GALGAS_string ("ECUC-MODULE-DEF"))) ;
+      if (kBoolTrue != test_2.boolEnum ()) {
+        test_2 = GALGAS_bool (kIsEqual, constinArgument_name.objectCompare (GALGAS_string ("ECUC-MODULE-CONFIGURATION-VALUES"))) ;
+      }
+      result_keep = test_2 ;
+    }
+  }
+//---
+  return result_keep ;
+}
+
+
+//--------------------------------------------------------------------------------------------------
+//  Function introspection                                                                       
+//--------------------------------------------------------------------------------------------------
+
+static const C_galgas_type_descriptor * functionArgs_arxmlKeepElement [3] = {
+  & kTypeDescriptor_GALGAS_string,
+  & kTypeDescriptor_GALGAS_string,
+  nullptr
+} ;
+
+//--------------------------------------------------------------------------------------------------
+
+static GALGAS_object functionWithGenericHeader_arxmlKeepElement (Compiler * inCompiler,
+                                                                 const cObjectArray & inEffectiveParameterArray,
+                                                                 const GALGAS_location & /* inErrorLocation */
+                                                                 COMMA_LOCATION_ARGS) {
+  const GALGAS_string operand0 = GALGAS_string::extractObject (inEffectiveParameterArray.objectAtIndex (0 COMMA_HERE),
+                                                               inCompiler
+                                                               COMMA_THERE) ;
+  const GALGAS_string operand1 = GALGAS_string::extractObject (inEffectiveParameterArray.objectAtIndex (1 COMMA_HERE),
+                                                               inCompiler
+                                                               COMMA_THERE) ;
+  return function_arxmlKeepElement (operand0,
+                                    operand1,
+                                    inCompiler
+                                    COMMA_THERE).getter_object (THERE) ;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+C_galgas_function_descriptor functionDescriptor_arxmlKeepElement ("arxmlKeepElement",
+                                                                  functionWithGenericHeader_arxmlKeepElement,
+                                                                  & kTypeDescriptor_GALGAS_bool,
+                                                                  2,
+                                                                  functionArgs_arxmlKeepElement) ;
+
+
 //--------------------------------------------------------------------------------------------------
 //
 //Routine 'convertToOil&&?'
@@ -10612,7 +10687,7 @@ static void routine_programRule_5F__33_ (const GALGAS_lstring constinArgument_in
   }
   GALGAS_arxmlNode var_root_1354 ;
   var_root_1354.drop () ;
-  cGrammar_arxml_5F_grammar::_performSourceFileParsing_ (inCompiler, constinArgument_inSourceFile, var_root_1354, GALGAS_bool (true), GALGAS_bool (true)  COMMA_SOURCE_FILE ("goil_program.galgas", 49)) ;
+  cGrammar_arxml_5F_grammar::_performSourceFileParsing_ (inCompiler, constinArgument_inSourceFile, var_root_1354, GALGAS_bool (gOption_goil_5F_options_arxmlStream.readProperty_value ()).operator_not (SOURCE_FILE ("goil_program.galgas", 51)), GALGAS_bool (true)  COMMA_SOURCE_FILE ("goil_program.galgas", 49)) ;
   callExtensionMethod_print ((cPtr_arxmlNode *) var_root_1354.ptr (), GALGAS_uint (uint32_t (0U)), inCompiler COMMA_SOURCE_FILE ("goil_program.galgas", 53)) ;
 }
 
@@ -8155,6 +8155,8 @@ class cGrammar_goil_5F_object_5F_level_5F_include : public cParser_goil_5F_synta
 
 extern C_BoolCommandLineOption gOption_goil_5F_options_arxmlDisplayOil ;
 
+extern C_BoolCommandLineOption gOption_goil_5F_options_arxmlStream ;
+
 extern C_BoolCommandLineOption gOption_goil_5F_options_warnMultiple ;
 
 extern C_BoolCommandLineOption gOption_goil_5F_options_pierreOption ;
@@ -537,7 +537,7 @@ void cParser_arxml_5F_parser::rule_arxml_5F_parser_arxml_5F_start_5F_symbol_i0_
   }
   inCompiler->acceptTerminal (Lexique_arxml_5F_scanner::kToken__3F__3E_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 60)) ;
   GALGAS_arxmlNodeList var_nodes_1672 = GALGAS_arxmlNodeList::class_func_emptyList (SOURCE_FILE ("arxml_parser.galgas", 62)) ;
-  nt_element_5F_list_ (var_nodes_1672, constinArgument_includeComments, constinArgument_doNotCondenseWhiteSpaces, inCompiler) ;
+  nt_element_5F_list_ (var_nodes_1672, constinArgument_includeComments, constinArgument_doNotCondenseWhiteSpaces, var_name_1409.readProperty_string (), GALGAS_bool (true), inCompiler) ;
   outArgument_rootNode = GALGAS_arxmlElementNode::class_func_new (var_name_1409, var_attributes_1436, var_nodes_1672  COMMA_SOURCE_FILE ("arxml_parser.galgas", 68)) ;
   GALGAS_lstring var_autosarVersion_1991 ;
   GALGAS_lstring var_autosarDescription_2021 ;
@@ -673,6 +673,8 @@ void cParser_arxml_5F_parser::rule_arxml_5F_parser_arxml_5F_start_5F_symbol_i0_i
 void cParser_arxml_5F_parser::rule_arxml_5F_parser_element_5F_list_i1_ (GALGAS_arxmlNodeList & ioArgument_nodes,
                                                                         const GALGAS_bool constinArgument_includeComments,
                                                                         const GALGAS_bool constinArgument_doNotCondenseWhiteSpaces,
+                                                                        const GALGAS_string constinArgument_parentPath,
+                                                                        const GALGAS_bool constinArgument_keep,
                                                                         Lexique_arxml_5F_scanner * inCompiler) {
   bool repeatFlag_0 = true ;
   while (repeatFlag_0) {
@@ -680,7 +682,7 @@ void cParser_arxml_5F_parser::rule_arxml_5F_parser_element_5F_list_i1_ (GALGAS_a
       {
       routine_addText_26__3F_ (ioArgument_nodes, constinArgument_doNotCondenseWhiteSpaces, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 193)) ;
       }
-      nt_element_ (ioArgument_nodes, constinArgument_includeComments, constinArgument_doNotCondenseWhiteSpaces, inCompiler) ;
+      nt_element_ (ioArgument_nodes, constinArgument_includeComments, constinArgument_doNotCondenseWhiteSpaces, constinArgument_parentPath, constinArgument_keep, inCompiler) ;
     }else{
       repeatFlag_0 = false ;
     }
@@ -719,12 +721,18 @@ void cParser_arxml_5F_parser::rule_arxml_5F_parser_element_5F_list_i1_indexing (
 void cParser_arxml_5F_parser::rule_arxml_5F_parser_element_i2_ (GALGAS_arxmlNodeList & ioArgument_nodes,
                                                                 const GALGAS_bool constinArgument_includeComments,
                                                                 const GALGAS_bool /* constinArgument_doNotCondenseWhiteSpaces */,
+                                                                const GALGAS_string /* constinArgument_parentPath */,
+                                                                const GALGAS_bool constinArgument_keep,
                                                                 Lexique_arxml_5F_scanner * inCompiler) {
   GALGAS_lstring var_commentString_6445 = inCompiler->synthetizedAttribute_tokenString () ;
   inCompiler->acceptTerminal (Lexique_arxml_5F_scanner::kToken_comment COMMA_SOURCE_FILE ("arxml_parser.galgas", 210)) ;
   enumGalgasBool test_0 = kBoolTrue ;
   if (kBoolTrue == test_0) {
-    test_0 = constinArgument_includeComments.boolEnum () ;
+    GALGAS_bool test_1 = constinArgument_includeComments ;
+    if (kBoolTrue == test_1.boolEnum ()) {
+      test_1 = constinArgument_keep ;
+    }
+    test_0 = test_1.boolEnum () ;
     if (kBoolTrue == test_0) {
       ioArgument_nodes.addAssign_operation (GALGAS_arxmlCommentNode::class_func_new (var_commentString_6445  COMMA_SOURCE_FILE ("arxml_parser.galgas", 212))  COMMA_SOURCE_FILE ("arxml_parser.galgas", 212)) ;
     }
@@ -749,13 +757,20 @@ void cParser_arxml_5F_parser::rule_arxml_5F_parser_element_i2_indexing (Lexique_
 void cParser_arxml_5F_parser::rule_arxml_5F_parser_element_i3_ (GALGAS_arxmlNodeList & ioArgument_nodes,
                                                                 const GALGAS_bool constinArgument_includeComments,
                                                                 const GALGAS_bool constinArgument_doNotCondenseWhiteSpaces,
+                                                                const GALGAS_string constinArgument_parentPath,
+                                                                const GALGAS_bool constinArgument_keep,
                                                                 Lexique_arxml_5F_scanner * inCompiler) {
   inCompiler->acceptTerminal (Lexique_arxml_5F_scanner::kToken__3C_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 223)) ;
   GALGAS_lstring var_name_6779 = inCompiler->synthetizedAttribute_tokenString () ;
   inCompiler->acceptTerminal (Lexique_arxml_5F_scanner::kToken_name COMMA_SOURCE_FILE ("arxml_parser.galgas", 224)) ;
+  GALGAS_bool test_0 = constinArgument_keep ;
+  if (kBoolTrue == test_0.boolEnum ()) {
+    test_0 = function_arxmlKeepElement (constinArgument_parentPath, var_name_6779.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 235)) ;
+  }
+  GALGAS_bool var_keepElement_7029 = test_0 ;
   GALGAS_arxmlAttributeMap var_attributeMap_6805 = GALGAS_arxmlAttributeMap::class_func_emptyMap (SOURCE_FILE ("arxml_parser.galgas", 225)) ;
-  bool repeatFlag_0 = true ;
-  while (repeatFlag_0) {
+  bool repeatFlag_1 = true ;
+  while (repeatFlag_1) {
     if (select_arxml_5F_parser_2 (inCompiler) == 2) {
       GALGAS_lstring var_attributeName_6872 = inCompiler->synthetizedAttribute_tokenString () ;
       inCompiler->acceptTerminal (Lexique_arxml_5F_scanner::kToken_name COMMA_SOURCE_FILE ("arxml_parser.galgas", 228)) ;
@@ -766,7 +781,7 @@ void cParser_arxml_5F_parser::rule_arxml_5F_parser_element_i3_ (GALGAS_arxmlNode
       var_attributeMap_6805.setter_insertKey (var_attributeName_6872, var_attributeValue_6920, inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 231)) ;
       }
     }else{
-      repeatFlag_0 = false ;
+      repeatFlag_1 = false ;
     }
   }
   GALGAS_arxmlNodeList var_nodeList_7021 = GALGAS_arxmlNodeList::class_func_emptyList (SOURCE_FILE ("arxml_parser.galgas", 234)) ;
@@ -776,19 +791,19 @@ void cParser_arxml_5F_parser::rule_arxml_5F_parser_element_i3_ (GALGAS_arxmlNode
   } break ;
   case 2: {
     inCompiler->acceptTerminal (Lexique_arxml_5F_scanner::kToken__3E_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 238)) ;
-    nt_element_5F_list_ (var_nodeList_7021, constinArgument_includeComments, constinArgument_doNotCondenseWhiteSpaces, inCompiler) ;
+    nt_element_5F_list_ (var_nodeList_7021, constinArgument_includeComments, constinArgument_doNotCondenseWhiteSpaces, constinArgument_parentPath.getter_lastPathComponent (SOURCE_FILE ("arxml_parser.galgas", 254)).add_operation (GALGAS_string ("/"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 254)).add_operation (var_name_6779.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 254)), var_keepElement_7029, inCompiler) ;
     {
     routine_addText_26__3F_ (var_nodeList_7021, constinArgument_doNotCondenseWhiteSpaces, inCompiler  COMMA_SOURCE_FILE ("arxml_parser.galgas", 244)) ;
     }
     inCompiler->acceptTerminal (Lexique_arxml_5F_scanner::kToken__3C__2F_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 246)) ;
     GALGAS_lstring var_closingName_7257 = inCompiler->synthetizedAttribute_tokenString () ;
     inCompiler->acceptTerminal (Lexique_arxml_5F_scanner::kToken_name COMMA_SOURCE_FILE ("arxml_parser.galgas", 247)) ;
-    enumGalgasBool test_1 = kBoolTrue ;
-    if (kBoolTrue == test_1) {
-      test_1 = GALGAS_bool (kIsNotEqual, var_closingName_7257.readProperty_string ().objectCompare (var_name_6779.readProperty_string ())).boolEnum () ;
-      if (kBoolTrue == test_1) {
-        TC_Array <C_FixItDescription> fixItArray2 ;
-        inCompiler->emitSemanticError (var_closingName_7257.readProperty_location (), GALGAS_string ("incorrect closing tag </").add_operation (var_closingName_7257.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 249)).add_operation (GALGAS_string ("> instead of </"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 250)).add_operation (var_name_6779.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 250)).add_operation (GALGAS_string (">"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 250)), fixItArray2  COMMA_SOURCE_FILE ("arxml_parser.galgas", 249)) ;
+    enumGalgasBool test_2 = kBoolTrue ;
+    if (kBoolTrue == test_2) {
+      test_2 = GALGAS_bool (kIsNotEqual, var_closingName_7257.readProperty_string ().objectCompare (var_name_6779.readProperty_string ())).boolEnum () ;
+      if (kBoolTrue == test_2) {
+        TC_Array <C_FixItDescription> fixItArray3 ;
+        inCompiler->emitSemanticError (var_closingName_7257.readProperty_location (), GALGAS_string ("incorrect closing tag </").add_operation (var_closingName_7257.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 249)).add_operation (GALGAS_string ("> instead of </"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 250)).add_operation (var_name_6779.readProperty_string (), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 250)).add_operation (GALGAS_string (">"), inCompiler COMMA_SOURCE_FILE ("arxml_parser.galgas", 250)), fixItArray3  COMMA_SOURCE_FILE ("arxml_parser.galgas", 249)) ;
       }
     }
     inCompiler->acceptTerminal (Lexique_arxml_5F_scanner::kToken__3E_ COMMA_SOURCE_FILE ("arxml_parser.galgas", 252)) ;
@@ -796,7 +811,13 @@ void cParser_arxml_5F_parser::rule_arxml_5F_parser_element_i3_ (GALGAS_arxmlNode
   default:
     break ;
   }
-  ioArgument_nodes.addAssign_operation (GALGAS_arxmlElementNode::class_func_new (var_name_6779, var_attributeMap_6805, var_nodeList_7021  COMMA_SOURCE_FILE ("arxml_parser.galgas", 255))  COMMA_SOURCE_FILE ("arxml_parser.galgas", 255)) ;
+  enumGalgasBool test_4 = kBoolTrue ;
+  if (kBoolTrue == test_4) {
+    test_4 = var_keepElement_7029.boolEnum () ;
+    if (kBoolTrue == test_4) {
+      ioArgument_nodes.addAssign_operation (GALGAS_arxmlElementNode::class_func_new (var_name_6779, var_attributeMap_6805, var_nodeList_7021  COMMA_SOURCE_FILE ("arxml_parser.galgas", 269))  COMMA_SOURCE_FILE ("arxml_parser.galgas", 269)) ;
+    }
+  }
 }
 
 //---------------------------------------------------------------------------------------------------------------------*
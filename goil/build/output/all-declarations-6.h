@@ -114,6 +114,8 @@ class cParser_arxml_5F_parser {
   protected: virtual void nt_element_ (class GALGAS_arxmlNodeList & ioArgument0,
                                        const class GALGAS_bool constinArgument1,
                                        const class GALGAS_bool constinArgument2,
+                                       const class GALGAS_string constinArgument3,
+                                       const class GALGAS_bool constinArgument4,
                                        class Lexique_arxml_5F_scanner * inLexique) = 0 ;
 
   protected: virtual void nt_element_parse (class Lexique_arxml_5F_scanner * inLexique) = 0 ;
@@ -123,6 +125,8 @@ class cParser_arxml_5F_parser {
   protected: virtual void nt_element_5F_list_ (class GALGAS_arxmlNodeList & ioArgument0,
                                                const class GALGAS_bool constinArgument1,
                                                const class GALGAS_bool constinArgument2,
+                                               const class GALGAS_string constinArgument3,
+                                               const class GALGAS_bool constinArgument4,
                                                class Lexique_arxml_5F_scanner * inLexique) = 0 ;
 
   protected: virtual void nt_element_5F_list_parse (class Lexique_arxml_5F_scanner * inLexique) = 0 ;
@@ -143,6 +147,8 @@ class cParser_arxml_5F_parser {
   protected: void rule_arxml_5F_parser_element_5F_list_i1_ (GALGAS_arxmlNodeList & ioArgument0,
                                                             const GALGAS_bool constinArgument1,
                                                             const GALGAS_bool constinArgument2,
+                                                            const GALGAS_string constinArgument3,
+                                                            const GALGAS_bool constinArgument4,
                                                             Lexique_arxml_5F_scanner * inLexique) ;
 
   protected: void rule_arxml_5F_parser_element_5F_list_i1_parse (Lexique_arxml_5F_scanner * inLexique) ;
@@ -152,6 +158,8 @@ class cParser_arxml_5F_parser {
   protected: void rule_arxml_5F_parser_element_i2_ (GALGAS_arxmlNodeList & ioArgument0,
                                                     const GALGAS_bool constinArgument1,
                                                     const GALGAS_bool constinArgument2,
+                                                    const GALGAS_string constinArgument3,
+                                                    const GALGAS_bool constinArgument4,
                                                     Lexique_arxml_5F_scanner * inLexique) ;
 
   protected: void rule_arxml_5F_parser_element_i2_parse (Lexique_arxml_5F_scanner * inLexique) ;
@@ -161,6 +169,8 @@ class cParser_arxml_5F_parser {
   protected: void rule_arxml_5F_parser_element_i3_ (GALGAS_arxmlNodeList & ioArgument0,
                                                     const GALGAS_bool constinArgument1,
                                                     const GALGAS_bool constinArgument2,
+                                                    const GALGAS_string constinArgument3,
+                                                    const GALGAS_bool constinArgument4,
                                                     Lexique_arxml_5F_scanner * inLexique) ;
 
   protected: void rule_arxml_5F_parser_element_i3_parse (Lexique_arxml_5F_scanner * inLexique) ;
@@ -1289,6 +1299,17 @@ void routine_addText_26__3F_ (class GALGAS_arxmlNodeList & ioArgument0,
                               class Compiler * inCompiler
                               COMMA_LOCATION_ARGS) ;
 
+//--------------------------------------------------------------------------------------------------
+//
+//Function 'arxmlKeepElement'
+//
+//--------------------------------------------------------------------------------------------------
+
+class GALGAS_bool function_arxmlKeepElement (const class GALGAS_string & constinArgument0,
+                                             const class GALGAS_string & constinArgument1,
+                                             class Compiler * inCompiler
+                                             COMMA_LOCATION_ARGS) ;
+
 //--------------------------------------------------------------------------------------------------
 //
 //Routine 'convertToOil&&?'
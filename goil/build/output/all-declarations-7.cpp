@@ -7322,8 +7322,10 @@ void cGrammar_arxml_5F_grammar::nt_element_5F_list_indexing (Lexique_arxml_5F_sc
 void cGrammar_arxml_5F_grammar::nt_element_5F_list_ (GALGAS_arxmlNodeList & parameter_1,
                                 const GALGAS_bool parameter_2,
                                 const GALGAS_bool parameter_3,
+                                const GALGAS_string parameter_4,
+                                const GALGAS_bool parameter_5,
                                 Lexique_arxml_5F_scanner * inLexique) {
-  rule_arxml_5F_parser_element_5F_list_i1_(parameter_1, parameter_2, parameter_3, inLexique) ;
+  rule_arxml_5F_parser_element_5F_list_i1_(parameter_1, parameter_2, parameter_3, parameter_4, parameter_5, inLexique) ;
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -7361,13 +7363,15 @@ void cGrammar_arxml_5F_grammar::nt_element_indexing (Lexique_arxml_5F_scanner *
 void cGrammar_arxml_5F_grammar::nt_element_ (GALGAS_arxmlNodeList & parameter_1,
                                 const GALGAS_bool parameter_2,
                                 const GALGAS_bool parameter_3,
+                                const GALGAS_string parameter_4,
+                                const GALGAS_bool parameter_5,
                                 Lexique_arxml_5F_scanner * inLexique) {
   switch (inLexique->nextProductionIndex ()) {
   case 1 :
-    rule_arxml_5F_parser_element_i2_(parameter_1, parameter_2, parameter_3, inLexique) ;
+    rule_arxml_5F_parser_element_i2_(parameter_1, parameter_2, parameter_3, parameter_4, parameter_5, inLexique) ;
     break ;
   case 2 :
-    rule_arxml_5F_parser_element_i3_(parameter_1, parameter_2, parameter_3, inLexique) ;
+    rule_arxml_5F_parser_element_i3_(parameter_1, parameter_2, parameter_3, parameter_4, parameter_5, inLexique) ;
     break ;
   default :
     break ;
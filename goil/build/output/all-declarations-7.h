@@ -1394,6 +1394,8 @@ class cGrammar_arxml_5F_grammar : public cParser_arxml_5F_parser {
   public: virtual void nt_element_ (GALGAS_arxmlNodeList & ioArgument0,
                                     const GALGAS_bool inArgument1,
                                     const GALGAS_bool inArgument2,
+                                    const GALGAS_string inArgument3,
+                                    const GALGAS_bool inArgument4,
                                     Lexique_arxml_5F_scanner * inCompiler) ;
 
 //------------------------------------- 'element_list' non terminal
@@ -1407,6 +1409,8 @@ class cGrammar_arxml_5F_grammar : public cParser_arxml_5F_parser {
   public: virtual void nt_element_5F_list_ (GALGAS_arxmlNodeList & ioArgument0,
                                             const GALGAS_bool inArgument1,
                                             const GALGAS_bool inArgument2,
+                                            const GALGAS_string inArgument3,
+                                            const GALGAS_bool inArgument4,
                                             Lexique_arxml_5F_scanner * inCompiler) ;
 
   public: virtual int32_t select_arxml_5F_parser_0 (Lexique_arxml_5F_scanner *) ;
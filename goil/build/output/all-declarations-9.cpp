@@ -2,6 +2,7 @@
 #include "C_galgas_io.h"
 #include "C_galgas_CLI_Options.h"
 #include "PrologueEpilogue.h"
+#include "Profiler.h"
 
 //--------------------------------------------------------------------------------------------------
 
@@ -7647,6 +7648,7 @@ void cPtr_gtlTemplateInstruction::method_execute (GALGAS_gtlContext & ioArgument
   if (kBoolTrue == test_3) {
     test_3 = var_found_14775.boolEnum () ;
     if (kBoolTrue == test_3) {
+      const ProfilerSection section ("template", var_templateFileName_14104.readProperty_string ().stringValue ()) ;
       callExtensionMethod_execute ((cPtr_gtlTemplate *) var_result_14803.ptr (), var_newContext_14000, var_localVars_14262, ioArgument_lib, ioArgument_outputString, inCompiler COMMA_SOURCE_FILE ("gtl_instructions.galgas", 512)) ;
     }
   }
@@ -0,0 +1,299 @@
+/**
+ * @file tpl_can_socketcan_driver.c
+ *
+ * @section desc File description
+ *
+ * See tpl_can_socketcan_driver.h for description.
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline OS
+ *
+ * Trampoline is copyright (c) IRCCyN 2005+
+ * Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the Lesser GNU Public Licence
+ *
+ *  @section infos File informations
+ *
+ *  $Date$
+ *  $Rev$
+ *  $Author$
+ *  $URL$
+ */
+#define _GNU_SOURCE // For recvmmsg(), sendmmsg() and F_SETSIG
+
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/can/raw.h>
+#include <net/if.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <Can.h>
+#include <tpl_can_socketcan_driver.h>
+#include <tpl_os.h>
+
+static int socketcan_enable_fd_frames(struct tpl_can_socketcan_priv *priv, CanControllerBaudrateConfig *baud_rate_config)
+{
+	int enable = baud_rate_config->use_fd_configuration ? 1 : 0;
+
+	if (setsockopt(priv->socket, SOL_CAN_RAW, CAN_RAW_FD_FRAMES, &enable, sizeof(enable)) < 0)
+	{
+		perror("[tpl_can_socketcan] setsockopt(CAN_RAW_FD_FRAMES)");
+		return -errno;
+	}
+
+	priv->is_can_fd_enabled = enable;
+	priv->is_bit_rate_switch_enabled = enable && baud_rate_config->can_fd_config.CanControllerTxBitRateSwitch;
+	return 0;
+}
+
+/*
+ * Convert a CAN stack frame to a SocketCAN frame.
+ * Return the number of bytes to write to the socket, or 0 if the frame can't
+ * be sent by this controller.
+ */
+static unsigned int socketcan_from_pdu(struct tpl_can_socketcan_priv *priv, const Can_PduType *pdu_info, struct canfd_frame *frame)
+{
+	uint32 type = TPL_CAN_ID_TYPE_GET(pdu_info->id);
+	uint32 is_fd_frame = type & 0x01;
+	uint32 is_extended = type & 0x02;
+	uint32 length = pdu_info->length;
+
+	memset(frame, 0, sizeof(*frame));
+
+	if (is_extended)
+		frame->can_id = (pdu_info->id & CAN_EFF_MASK) | CAN_EFF_FLAG;
+	else
+		frame->can_id = pdu_info->id & CAN_SFF_MASK;
+
+	if (is_fd_frame)
+	{
+		if (!priv->is_can_fd_enabled)
+			return 0;
+		// Round the payload size up to the next valid CAN-FD size, the padding bytes are zeroed
+		if (length > 0 && tpl_can_get_dlc_from_length(length, &length) == 0)
+			return 0;
+		memcpy(frame->data, pdu_info->sdu, pdu_info->length);
+		frame->len = (uint8) length;
+		if (priv->is_bit_rate_switch_enabled)
+			frame->flags = CANFD_BRS;
+		return CANFD_MTU;
+	}
+
+	if (length > TPL_CAN_CLASSIC_FRAME_MAXIMUM_PAYLOAD_SIZE)
+		return 0;
+	memcpy(frame->data, pdu_info->sdu, length);
+	frame->len = (uint8) length;
+	return CAN_MTU;
+}
+
+/*
+ * Convert a SocketCAN frame to a CAN stack frame. The payload is copied to
+ * the buffer pointed by pdu_info->sdu.
+ */
+static void socketcan_to_pdu(const struct canfd_frame *frame, unsigned int size, Can_PduType *pdu_info)
+{
+	uint32 type = (size == CANFD_MTU) ? TPL_CAN_ID_TYPE_FD_STANDARD : TPL_CAN_ID_TYPE_STANDARD;
+
+	if (frame->can_id & CAN_EFF_FLAG)
+		pdu_info->id = (frame->can_id & CAN_EFF_MASK) | type | TPL_CAN_ID_TYPE_EXTENDED;
+	else
+		pdu_info->id = (frame->can_id & CAN_SFF_MASK) | type;
+
+	pdu_info->length = frame->len;
+	memcpy(pdu_info->sdu, frame->data, frame->len);
+}
+
+/*
+ * Read as many frames as possible, up to TPL_CAN_SOCKETCAN_BATCH_SIZE, with
+ * a single system call.
+ */
+static void socketcan_fill_rx_batch(struct tpl_can_socketcan_priv *priv)
+{
+	struct mmsghdr msgs[TPL_CAN_SOCKETCAN_BATCH_SIZE];
+	struct iovec iovecs[TPL_CAN_SOCKETCAN_BATCH_SIZE];
+	unsigned int i;
+	int count;
+
+	memset(msgs, 0, sizeof(msgs));
+	for (i = 0; i < TPL_CAN_SOCKETCAN_BATCH_SIZE; i++)
+	{
+		iovecs[i].iov_base = &priv->rx_frames[i];
+		iovecs[i].iov_len = sizeof(priv->rx_frames[i]);
+		msgs[i].msg_hdr.msg_iov = &iovecs[i];
+		msgs[i].msg_hdr.msg_iovlen = 1;
+	}
+
+	count = recvmmsg(priv->socket, msgs, TPL_CAN_SOCKETCAN_BATCH_SIZE, MSG_DONTWAIT, NULL);
+	if (count < 0)
+		count = 0;
+
+	for (i = 0; i < (unsigned int) count; i++)
+		priv->rx_sizes[i] = msgs[i].msg_len;
+
+	priv->rx_count = (unsigned int) count;
+	priv->rx_index = 0;
+}
+
+int tpl_can_socketcan_init(struct tpl_can_controller_config_t *config)
+{
+	struct tpl_can_socketcan_priv *priv = config->controller->priv;
+	struct sockaddr_can address;
+	struct ifreq ifr;
+	int flags, ret;
+
+	priv->socket = socket(PF_CAN, SOCK_RAW, CAN_RAW);
+	if (priv->socket < 0)
+	{
+		perror("[tpl_can_socketcan] socket");
+		return -errno;
+	}
+
+	memset(&ifr, 0, sizeof(ifr));
+	strncpy(ifr.ifr_name, priv->interface_name, IFNAMSIZ - 1);
+	if (ioctl(priv->socket, SIOCGIFINDEX, &ifr) < 0)
+	{
+		fprintf(stderr, "[tpl_can_socketcan] Unknown CAN interface '%s'.\r\n", priv->interface_name);
+		ret = -errno;
+		goto error;
+	}
+
+	ret = socketcan_enable_fd_frames(priv, &config->baud_rate_config);
+	if (ret)
+		goto error;
+
+	memset(&address, 0, sizeof(address));
+	address.can_family = AF_CAN;
+	address.can_ifindex = ifr.ifr_ifindex;
+	if (bind(priv->socket, (struct sockaddr *) &address, sizeof(address)) < 0)
+	{
+		perror("[tpl_can_socketcan] bind");
+		ret = -errno;
+		goto error;
+	}
+
+	// The socket is never blocking, an OS task or ISR can't wait for the bus
+	flags = fcntl(priv->socket, F_GETFL);
+	flags |= O_NONBLOCK;
+
+	// Route the reception notification to the ISR2 signal
+	if (priv->rx_signal != 0)
+	{
+		if ((fcntl(priv->socket, F_SETOWN, getpid()) < 0) || (fcntl(priv->socket, F_SETSIG, priv->rx_signal) < 0))
+		{
+			perror("[tpl_can_socketcan] fcntl");
+			ret = -errno;
+			goto error;
+		}
+		flags |= O_ASYNC;
+	}
+
+	if (fcntl(priv->socket, F_SETFL, flags) < 0)
+	{
+		perror("[tpl_can_socketcan] fcntl");
+		ret = -errno;
+		goto error;
+	}
+
+	priv->rx_count = 0;
+	priv->rx_index = 0;
+	return 0;
+
+error:
+	close(priv->socket);
+	priv->socket = -1;
+	return ret;
+}
+
+int tpl_can_socketcan_set_baudrate(struct tpl_can_controller_t *ctrl, CanControllerBaudrateConfig *baud_rate_config)
+{
+	// The bit timings of a SocketCAN interface are set from the host with
+	// "ip link set <interface> type can bitrate ...", only the CAN-FD frames
+	// support can be changed from here
+	return socketcan_enable_fd_frames(ctrl->priv, baud_rate_config);
+}
+
+Std_ReturnType tpl_can_socketcan_transmit(struct tpl_can_controller_t *ctrl, const Can_PduType *pdu_info)
+{
+	struct tpl_can_socketcan_priv *priv = ctrl->priv;
+	struct canfd_frame frame;
+	unsigned int size;
+
+	size = socketcan_from_pdu(priv, pdu_info, &frame);
+	if (size == 0)
+		return E_NOT_OK;
+
+	if (write(priv->socket, &frame, size) != (ssize_t) size)
+		return E_NOT_OK;
+
+	return E_OK;
+}
+
+unsigned int tpl_can_socketcan_transmit_batch(struct tpl_can_controller_t *ctrl, const Can_PduType *pdus, unsigned int count)
+{
+	struct tpl_can_socketcan_priv *priv = ctrl->priv;
+	struct canfd_frame frames[TPL_CAN_SOCKETCAN_BATCH_SIZE];
+	struct mmsghdr msgs[TPL_CAN_SOCKETCAN_BATCH_SIZE];
+	struct iovec iovecs[TPL_CAN_SOCKETCAN_BATCH_SIZE];
+	unsigned int sent = 0, batch, size;
+	int ret;
+
+	while (sent < count)
+	{
+		memset(msgs, 0, sizeof(msgs));
+
+		// Convert the next frames, up to the first invalid one
+		for (batch = 0; (batch < TPL_CAN_SOCKETCAN_BATCH_SIZE) && (sent + batch < count); batch++)
+		{
+			size = socketcan_from_pdu(priv, &pdus[sent + batch], &frames[batch]);
+			if (size == 0)
+				break;
+			iovecs[batch].iov_base = &frames[batch];
+			iovecs[batch].iov_len = size;
+			msgs[batch].msg_hdr.msg_iov = &iovecs[batch];
+			msgs[batch].msg_hdr.msg_iovlen = 1;
+		}
+		if (batch == 0)
+			break;
+
+		ret = sendmmsg(priv->socket, msgs, batch, MSG_DONTWAIT);
+		if (ret <= 0)
+			break;
+		sent += (unsigned int) ret;
+
+		// Partial write, the transmit queue is full
+		if ((unsigned int) ret < batch)
+			break;
+	}
+
+	return sent;
+}
+
+Std_ReturnType tpl_can_socketcan_receive(struct tpl_can_controller_t *ctrl, Can_PduType *pdu_info)
+{
+	struct tpl_can_socketcan_priv *priv = ctrl->priv;
+
+	if (!tpl_can_socketcan_is_data_available(ctrl))
+		return E_NOT_OK;
+
+	socketcan_to_pdu(&priv->rx_frames[priv->rx_index], priv->rx_sizes[priv->rx_index], pdu_info);
+	priv->rx_index++;
+
+	return E_OK;
+}
+
+int tpl_can_socketcan_is_data_available(struct tpl_can_controller_t *ctrl)
+{
+	struct tpl_can_socketcan_priv *priv = ctrl->priv;
+
+	// Refill the batch only once all the previously read frames are consumed
+	if (priv->rx_index >= priv->rx_count)
+		socketcan_fill_rx_batch(priv);
+
+	return priv->rx_index < priv->rx_count;
+}
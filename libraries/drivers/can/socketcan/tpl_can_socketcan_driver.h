@@ -0,0 +1,105 @@
+/**
+ * @file tpl_can_socketcan_driver.h
+ *
+ * @section desc File description
+ *
+ * CAN controller driver for the POSIX target, based on Linux SocketCAN.
+ * Each controller is bound to a SocketCAN network interface (a real CAN
+ * interface or a virtual one like vcan0, which needs no hardware). Frames
+ * are read and written by batches with recvmmsg() and sendmmsg(), CAN-FD
+ * is supported when the controller is configured with a CAN-FD baud rate.
+ *
+ * The reception can be signaled to an ISR2 : when the controller is
+ * declared with a non-zero signal, the socket is switched to asynchronous
+ * mode and the kernel sends this signal each time frames are received.
+ * Declare the ISR2 with the same signal as SOURCE (SIGIO is the usual one)
+ * and call CanIf_ReadRxPduData() from the ISR until it returns E_NOT_OK.
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline OS
+ *
+ * Trampoline is copyright (c) IRCCyN 2005+
+ * Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the Lesser GNU Public Licence
+ *
+ *  @section infos File informations
+ *
+ *  $Date$
+ *  $Rev$
+ *  $Author$
+ *  $URL$
+ */
+#ifndef TPL_CAN_SOCKETCAN_DRIVER_H
+#define TPL_CAN_SOCKETCAN_DRIVER_H
+
+#include <Can.h>
+#include <linux/can.h>
+
+/**
+ * Maximum number of frames read by a single recvmmsg() call or written by
+ * a single sendmmsg() call.
+ */
+#define TPL_CAN_SOCKETCAN_BATCH_SIZE (32)
+
+/**
+ * @struct tpl_can_socketcan_priv
+ *
+ * Driver internal data of a SocketCAN controller. Only interface_name and
+ * rx_signal are provided by the application, through the
+ * TPL_CAN_SOCKETCAN_CONTROLLER() macro.
+ */
+struct tpl_can_socketcan_priv
+{
+	const char *interface_name;
+	int rx_signal; // Signal sent when frames are received, 0 to poll the controller
+	int socket;
+	int is_can_fd_enabled;
+	int is_bit_rate_switch_enabled;
+	unsigned int rx_count; // Number of frames read by the last recvmmsg() call
+	unsigned int rx_index; // Next frame to give to the CAN stack
+	struct canfd_frame rx_frames[TPL_CAN_SOCKETCAN_BATCH_SIZE];
+	unsigned int rx_sizes[TPL_CAN_SOCKETCAN_BATCH_SIZE];
+};
+
+int tpl_can_socketcan_init(struct tpl_can_controller_config_t *config);
+int tpl_can_socketcan_set_baudrate(struct tpl_can_controller_t *ctrl, CanControllerBaudrateConfig *baud_rate_config);
+Std_ReturnType tpl_can_socketcan_transmit(struct tpl_can_controller_t *ctrl, const Can_PduType *pdu_info);
+Std_ReturnType tpl_can_socketcan_receive(struct tpl_can_controller_t *ctrl, Can_PduType *pdu_info);
+int tpl_can_socketcan_is_data_available(struct tpl_can_controller_t *ctrl);
+
+/**
+ * Transmit several frames with as few sendmmsg() calls as possible.
+ *
+ * @param ctrl The controller to use.
+ * @param pdus The frames to transmit.
+ * @param count The number of frames.
+ *
+ * @return The number of frames written to the socket. The transmission stops
+ * at the first invalid frame or when the socket transmit queue is full.
+ */
+unsigned int tpl_can_socketcan_transmit_batch(struct tpl_can_controller_t *ctrl, const Can_PduType *pdus, unsigned int count);
+
+/**
+ * Declare a SocketCAN controller.
+ *
+ * @param name The name of the tpl_can_controller_t variable to define.
+ * @param interface The name of the SocketCAN network interface (e.g. "vcan0").
+ * @param signal The signal sent on frame reception (e.g. SIGIO), 0 if the
+ * controller is polled.
+ */
+#define TPL_CAN_SOCKETCAN_CONTROLLER(name, interface, signal) \
+	static struct tpl_can_socketcan_priv name##_priv = { .interface_name = interface, .rx_signal = signal, .socket = -1 }; \
+	tpl_can_controller_t name = \
+	{ \
+		0, \
+		tpl_can_socketcan_init, \
+		tpl_can_socketcan_set_baudrate, \
+		tpl_can_socketcan_transmit, \
+		tpl_can_socketcan_receive, \
+		tpl_can_socketcan_is_data_available, \
+		&name##_priv \
+	}
+
+#endif
@@ -27,9 +27,70 @@
 #ifndef CAN_IF_H
 #define CAN_IF_H
 
+#include <Can_GeneralTypes.h>
 #include <ComStack_Types.h>
 #include <tpl_os_types.h>
 
+/**
+ * Mask to use in a CanIf_RxPduConfigType to match a single CAN ID. The CAN-FD
+ * flag of the frame type is never compared, so a route matches both the CAN
+ * 2.0 and the CAN-FD frames with this ID.
+ */
+#define TPL_CANIF_EXACT_MASK (TPL_CAN_ID_TYPE_EXTENDED | TPL_CAN_ID_EXTENDED_MASK)
+
+/**
+ * Number of slots of the hash table used to find the route of a single CAN ID.
+ * Must be a power of two. At most half of the slots can be used, so that the
+ * lookup stays fast.
+ */
+#define TPL_CANIF_RX_HASH_SIZE (256)
+
+/**
+ * @typedef CanIf_RxPduConfigType
+ *
+ * Route the received frames whose CAN ID matches id on the bits set in mask
+ * to an upper layer PDU.
+ */
+typedef struct
+{
+	Can_IdType id; // CAN ID ORed with the frame type flag (TPL_CAN_ID_TYPE_xx)
+	Can_IdType mask; // Compared bits of the CAN ID, TPL_CANIF_EXACT_MASK for a single ID
+	PduIdType pdu_id; // Upper layer PDU identifier
+	Can_PduType *buffer; // Receives the frame, buffer->sdu must point to a large enough payload buffer
+	void (*rx_indication)(PduIdType pdu_id, const Can_PduType *pdu); // Called after the copy, may be NULL
+} CanIf_RxPduConfigType;
+
+/**
+ * @typedef CanIf_AcceptanceFilterType
+ *
+ * Software acceptance filter of a controller, working like the acceptance
+ * filter of a CAN controller hardware : a frame is accepted if its CAN ID is
+ * equal to code on the bits set in mask. A null mask accepts all the frames.
+ */
+typedef struct
+{
+	Can_IdType code;
+	Can_IdType mask;
+} CanIf_AcceptanceFilterType;
+
+/**
+ * @typedef CanIf_ConfigType
+ *
+ * Reception routing configuration. The routes with TPL_CANIF_EXACT_MASK are
+ * found with a hash table, the other ones are tried in the order of the
+ * list. The acceptance filters are given by controller index, in the order
+ * of the controllers list provided to Can_Init(), controllers without a
+ * filter accept all the frames.
+ * The provided variable must be reachable during all the application lifetime.
+ */
+typedef struct
+{
+	const CanIf_RxPduConfigType *rx_pdus;
+	unsigned int rx_pdus_count;
+	const CanIf_AcceptanceFilterType *filters;
+	unsigned int filters_count;
+} CanIf_ConfigType;
+
 /**
  * This service initializes internal and external interfaces of the CAN
  * interfaces for the further processing.
@@ -104,4 +165,29 @@ Std_ReturnType CanIf_ReadRxPduData(PduIdType CanIfRxSduId, PduInfoType *CanIfRxI
  */
 void tpl_can_fill_pdu_info(Can_PduType *can_pdu, PduInfoType *pdu_info, Can_IdType id_and_flags, void *payload, uint32 payload_length);
 
+/**
+ * Set the reception routing configuration used by CanIf_DispatchRx().
+ *
+ * @param Config Pointer to the routing configuration.
+ *
+ * @retval E_OK The routing tables have been built.
+ * @retval E_NOT_OK Too many single CAN ID routes (more than half of
+ * TPL_CANIF_RX_HASH_SIZE), too many masked routes (more than
+ * TPL_CANIF_RX_HASH_SIZE) or a route without buffer.
+ */
+Std_ReturnType CanIf_SetRxRouting(const CanIf_ConfigType *Config);
+
+/**
+ * Read all the frames available on a controller and route them. The frames
+ * rejected by the acceptance filter of the controller or without route are
+ * dropped. This function is meant to be called from the reception ISR of
+ * the controller.
+ *
+ * @param ControllerId Index of the controller in the controllers list
+ * provided to Can_Init().
+ *
+ * @return The number of frames copied to a PDU buffer.
+ */
+unsigned int CanIf_DispatchRx(uint8 ControllerId);
+
 #endif
@@ -25,11 +25,21 @@
  */
 #include <Can.h>
 #include <CanIf.h>
+#include <string.h>
 #include <tpl_os_definitions.h>
 
 static tpl_can_controller_config_t *controller_configs;
 static unsigned int controllers_count;
 
+// CanIf reception routing
+#define TPL_CANIF_RX_HASH_EMPTY (0xFFFF)
+static const CanIf_ConfigType *canif_config;
+// Index in canif_config->rx_pdus of the single CAN ID routes, TPL_CANIF_RX_HASH_EMPTY for a free slot
+static uint16 canif_rx_hash[TPL_CANIF_RX_HASH_SIZE];
+// Index in canif_config->rx_pdus of the masked routes
+static uint16 canif_rx_masked[TPL_CANIF_RX_HASH_SIZE];
+static unsigned int canif_rx_masked_count;
+
 int Can_Init(const Can_ConfigType *Config)
 {
 	int ret;
@@ -150,6 +160,134 @@ Std_ReturnType CanIf_ReadRxPduData(PduIdType CanIfRxSduId, PduInfoType *CanIfRxI
 	return controller->receive(controller, can_pdu);
 }
 
+/*
+ * Fibonacci hashing of a CAN ID, the CAN-FD flag is never part of the key.
+ */
+static unsigned int canif_hash(Can_IdType id)
+{
+	uint32 key = id & TPL_CANIF_EXACT_MASK;
+	uint32 hash = key * 2654435761U;
+
+	// The upper bits are the best mixed ones
+	return (unsigned int) (hash >> 16) & (TPL_CANIF_RX_HASH_SIZE - 1);
+}
+
+Std_ReturnType CanIf_SetRxRouting(const CanIf_ConfigType *Config)
+{
+	const CanIf_RxPduConfigType *route;
+	unsigned int i, slot, exact_count = 0;
+
+	canif_config = NULL;
+	canif_rx_masked_count = 0;
+	for (i = 0; i < TPL_CANIF_RX_HASH_SIZE; i++)
+		canif_rx_hash[i] = TPL_CANIF_RX_HASH_EMPTY;
+
+	for (i = 0; i < Config->rx_pdus_count; i++)
+	{
+		route = &Config->rx_pdus[i];
+		if (route->buffer == NULL)
+			return E_NOT_OK;
+		if ((route->mask & TPL_CANIF_EXACT_MASK) != TPL_CANIF_EXACT_MASK)
+		{
+			if (canif_rx_masked_count == TPL_CANIF_RX_HASH_SIZE)
+				return E_NOT_OK;
+			canif_rx_masked[canif_rx_masked_count++] = (uint16) i;
+			continue;
+		}
+
+		// Keep the table at most half full so that the probe sequences stay short
+		exact_count++;
+		if (exact_count > TPL_CANIF_RX_HASH_SIZE / 2)
+			return E_NOT_OK;
+
+		// Linear probing, the first route given for an ID wins
+		slot = canif_hash(route->id);
+		while (canif_rx_hash[slot] != TPL_CANIF_RX_HASH_EMPTY)
+		{
+			if (((Config->rx_pdus[canif_rx_hash[slot]].id ^ route->id) & TPL_CANIF_EXACT_MASK) == 0)
+				break;
+			slot = (slot + 1) & (TPL_CANIF_RX_HASH_SIZE - 1);
+		}
+		if (canif_rx_hash[slot] == TPL_CANIF_RX_HASH_EMPTY)
+			canif_rx_hash[slot] = (uint16) i;
+	}
+
+	canif_config = Config;
+	return E_OK;
+}
+
+/*
+ * Find the route of a received CAN ID, NULL if there is none.
+ */
+static const CanIf_RxPduConfigType *canif_find_route(Can_IdType id)
+{
+	const CanIf_RxPduConfigType *route;
+	unsigned int i, slot;
+
+	// Single CAN ID routes first, in constant time
+	slot = canif_hash(id);
+	while (canif_rx_hash[slot] != TPL_CANIF_RX_HASH_EMPTY)
+	{
+		route = &canif_config->rx_pdus[canif_rx_hash[slot]];
+		if (((route->id ^ id) & TPL_CANIF_EXACT_MASK) == 0)
+			return route;
+		slot = (slot + 1) & (TPL_CANIF_RX_HASH_SIZE - 1);
+	}
+
+	// Then the masked routes, in the configuration order
+	for (i = 0; i < canif_rx_masked_count; i++)
+	{
+		route = &canif_config->rx_pdus[canif_rx_masked[i]];
+		if (((route->id ^ id) & route->mask & ~TPL_CAN_ID_TYPE_FD_STANDARD) == 0)
+			return route;
+	}
+
+	return NULL;
+}
+
+unsigned int CanIf_DispatchRx(uint8 ControllerId)
+{
+	tpl_can_controller_t *controller;
+	const CanIf_AcceptanceFilterType *filter = NULL;
+	const CanIf_RxPduConfigType *route;
+	uint8 payload[TPL_CAN_FD_FRAME_MAXIMUM_PAYLOAD_SIZE];
+	Can_PduType frame;
+	unsigned int count = 0;
+
+	if ((ControllerId >= controllers_count) || (canif_config == NULL))
+		return 0;
+	controller = controller_configs[ControllerId].controller;
+
+	if (ControllerId < canif_config->filters_count)
+		filter = &canif_config->filters[ControllerId];
+
+	frame.sdu = payload;
+	while (controller->is_data_available(controller))
+	{
+		if (controller->receive(controller, &frame) != E_OK)
+			break;
+
+		// Hardware-style acceptance filter, the rejected frames are dropped at once
+		if ((filter != NULL) && (((frame.id ^ filter->code) & filter->mask) != 0))
+			continue;
+
+		route = canif_find_route(frame.id);
+		if (route == NULL)
+			continue;
+
+		route->buffer->id = frame.id;
+		route->buffer->length = frame.length;
+		route->buffer->swPduHandle = route->pdu_id;
+		memcpy(route->buffer->sdu, frame.sdu, frame.length);
+		count++;
+
+		if (route->rx_indication != NULL)
+			route->rx_indication(route->pdu_id, route->buffer);
+	}
+
+	return count;
+}
+
 uint32 tpl_can_get_dlc_from_length(uint32 length, uint32 *adjusted_length)
 {
 	struct length_code_t
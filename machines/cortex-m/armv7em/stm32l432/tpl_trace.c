@@ -141,6 +141,58 @@ FUNC(void, OS_CODE) tpl_trace_proc_change_state(
 #endif
 }
 
+#if WITH_DEFERRED_SCHEDULE == YES
+/**
+* trace a reschedule skipped by a service called from an ISR2 and the
+* election that ends a burst of ISR2.
+* ** Functions defined in os/tpl_trace.h **
+*/
+STATIC FUNC(void, OS_CODE) tpl_trace_schedule(
+    CONST(uint8, AUTOMATIC) kind,
+    CONST(uint8, AUTOMATIC) data)
+{
+  const tpl_tick ts=tpl_trace_get_timestamp();
+  tpl_trace_start();
+# if TRACE_FORMAT == TRACE_FORMAT_SERIAL
+  /* TTT 0000 K (Type, Kind) */
+  uint8_t byte = SCHEDULE_TYPE<<5 | kind;
+  uint8_t chksum = byte;
+  int overflow = 0;
+  overflow |= tpl_serial_putchar(byte);
+
+  byte = ts >> 8;
+  chksum += byte;
+  overflow |= tpl_serial_putchar(byte);
+
+  byte = ts & 0xff;
+  chksum += byte;
+  overflow |= tpl_serial_putchar(byte);
+
+  byte = data;
+  chksum += byte;
+  overflow |= tpl_serial_putchar(byte);
+
+  overflow |= tpl_serial_putchar(chksum);
+  if(overflow) tpl_trace_overflow();
+# else
+#  error "unsupported trace mode: TRACE_FORMAT"
+#endif
+}
+
+FUNC(void, OS_CODE) tpl_trace_schedule_deferred(
+    CONST(tpl_proc_id, AUTOMATIC) proc_id)
+{
+  tpl_trace_schedule(SCHEDULE_DEFERRED_KIND, proc_id & 0xff);
+}
+
+FUNC(void, OS_CODE) tpl_trace_schedule_coalesced(
+    CONST(uint16, AUTOMATIC) count)
+{
+  /* the count saturates at 255 */
+  tpl_trace_schedule(SCHEDULE_COALESCED_KIND, (count > 0xff) ? 0xff : count);
+}
+#endif /* WITH_DEFERRED_SCHEDULE == YES */
+
 /**
 * trace the lock of a resource by an entity
 * ** Function defined in os/tpl_trace.h **
@@ -86,7 +86,26 @@ FUNC (void, OS_CODE) tpl_init_machine_generic (void)
 #if WITH_MEMORY_PROTECTION == YES
   tpl_init_mp();
 #endif
+#if WITH_CYCLE_COUNT == YES
+  /*
+   * Start the DWT cycle counter used to measure the services and the
+   * CPU time of the processes
+   */
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+}
+
+#if WITH_CYCLE_COUNT == YES
+#ifndef DWT
+#error "SERVICE_STATS and CPU_TIME need the DWT cycle counter of the Cortex-M3 and above"
+#endif
+FUNC(uint32, OS_CODE) tpl_get_cycle_count(void)
+{
+  return DWT->CYCCNT;
 }
+#endif
 
 FUNC (void, OS_CODE) tpl_init_machine_specific (void)
 {
@@ -40,6 +40,13 @@
 #include <sys/types.h>
 #include <unistd.h>
 #include <sys/wait.h>
+#if WITH_CYCLE_COUNT == YES
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#else
+#include <time.h>
+#endif
+#endif
 
 #include "tpl_machine_posix.h"
 #include "tpl_posixvp_irq_gen.h"
@@ -110,6 +117,23 @@ void tpl_release_task_lock(void)
     }
 }
 
+#if WITH_CYCLE_COUNT == YES
+/*
+ * tpl_get_cycle_count reads the time stamp counter of x86 hosts and the
+ * monotonic clock, in ns, on the other hosts
+ */
+FUNC(uint32, OS_CODE) tpl_get_cycle_count(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return (uint32)__rdtsc();
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32)((now.tv_sec * 1000000000ULL) + now.tv_nsec);
+#endif
+}
+#endif
+
 #define OS_START_SEC_CODE
 #include "tpl_memmap.h"
     FUNC(void, OS_CODE) tpl_switch_context(
@@ -218,7 +242,7 @@ void tpl_init_machine(void)
 
     tpl_viper_init();
 
-#if ((WITH_AUTOSAR == YES) && (SCHEDTABLE_COUNT > 0)) || (ALARM_COUNT > 0)
+#if ((WITH_AUTOSAR == YES) && (SCHEDTABLE_COUNT > 0)) || (ALARM_COUNT > 0) || (WITH_SEM_TIMEDWAIT == YES)
     tpl_viper_start_auto_timer(signal_for_counters,10000);  /* 10 ms */
 #endif
 
@@ -71,6 +71,20 @@ typedef uint32_t uint32;
  */
 typedef int32_t sint32;
 
+/**
+ * @typedef uint64
+ *
+ * 64 bits unsigned number
+ */
+typedef uint64_t uint64;
+
+/**
+ * @typedef sint64
+ *
+ * 64 bits signed number
+ */
+typedef int64_t sint64;
+
 #endif /* TPL_OS_STD_TYPES_H */
 
 /* End of file tpl_os_std_types.h */
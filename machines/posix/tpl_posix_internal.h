@@ -29,7 +29,7 @@
 #include "tpl_app_custom_types.h"
 
 /* TODO change viper API to hide this variable */
-#if ((WITH_AUTOSAR == YES) && (SCHEDTABLE_COUNT > 0)) || (ALARM_COUNT > 0)
+#if ((WITH_AUTOSAR == YES) && (SCHEDTABLE_COUNT > 0)) || (ALARM_COUNT > 0) || (WITH_SEM_TIMEDWAIT == YES)
 extern const int signal_for_counters;
 #endif
 
@@ -53,7 +53,7 @@ extern int signal_for_isr_id[ISR_COUNT];
 #if WITH_AUTOSAR_TIMING_PROTECTION == YES
 const int signal_for_watchdog = SIGALRM;
 #endif /* WITH_AUTOSAR_TIMING_PROTECTION */
-#if ((WITH_AUTOSAR == YES) && (SCHEDTABLE_COUNT > 0)) || (ALARM_COUNT > 0)
+#if ((WITH_AUTOSAR == YES) && (SCHEDTABLE_COUNT > 0)) || (ALARM_COUNT > 0) || (WITH_SEM_TIMEDWAIT == YES)
 const int signal_for_counters = SIGUSR2;
 #endif
 
@@ -128,7 +128,7 @@ void tpl_signal_handler(int sig)
   tpl_locking_depth++;
   tpl_cpt_os_task_lock++;
 
-#if ((WITH_AUTOSAR == YES) && (SCHEDTABLE_COUNT > 0)) || (ALARM_COUNT > 0)
+#if ((WITH_AUTOSAR == YES) && (SCHEDTABLE_COUNT > 0)) || (ALARM_COUNT > 0) || (WITH_SEM_TIMEDWAIT == YES)
   if (signal_for_counters == sig)
   {
     tpl_call_counter_tick();
@@ -172,7 +172,7 @@ void tpl_signal_handler(int sig)
 #if WITH_AUTOSAR_TIMING_PROTECTION == YES
     }
 #endif /* WITH_AUTOSAR_TIMING_PROTECTION */
-#if ((WITH_AUTOSAR == YES) && (SCHEDTABLE_COUNT > 0)) || (ALARM_COUNT > 0)
+#if ((WITH_AUTOSAR == YES) && (SCHEDTABLE_COUNT > 0)) || (ALARM_COUNT > 0) || (WITH_SEM_TIMEDWAIT == YES)
   }
 #endif /* (defined WITH_AUTOSAR && !defined NO_SCHEDTABLE) || ... */
 
@@ -221,7 +221,7 @@ void tpl_posix_siginit(void)
 #if WITH_AUTOSAR_TIMING_PROTECTION == YES
   sigaddset(&signal_set, signal_for_watchdog);
 #endif /* WITH_AUTOSAR_TIMING_PROTECTION */
-#if ((WITH_AUTOSAR == YES) && (SCHEDTABLE_COUNT > 0)) || (ALARM_COUNT > 0)
+#if ((WITH_AUTOSAR == YES) && (SCHEDTABLE_COUNT > 0)) || (ALARM_COUNT > 0) || (WITH_SEM_TIMEDWAIT == YES)
   sigaddset(&signal_set, signal_for_counters);
 #endif /*(defined WITH_AUTOSAR && !defined NO_SCHEDTABLE) || ... */
 
@@ -243,7 +243,7 @@ void tpl_posix_siginit(void)
 #if WITH_AUTOSAR_TIMING_PROTECTION == YES
   sigaction(signal_for_watchdog, &sa, NULL);
 #endif /* WITH_AUTOSAR_TIMING_PROTECTION */
-#if ((WITH_AUTOSAR == YES) && (SCHEDTABLE_COUNT > 0)) || (ALARM_COUNT > 0)
+#if ((WITH_AUTOSAR == YES) && (SCHEDTABLE_COUNT > 0)) || (ALARM_COUNT > 0) || (WITH_SEM_TIMEDWAIT == YES)
   sigaction(signal_for_counters, &sa, NULL);
 #endif /*(defined WITH_AUTOSAR && !defined NO_SCHEDTABLE) || ... */
 }
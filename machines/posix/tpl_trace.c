@@ -117,6 +117,98 @@ tpl_trace_proc_change_state(CONST(tpl_proc_id, AUTOMATIC) proc_id,
 #endif
 }
 
+#if WITH_DEFERRED_SCHEDULE == YES
+/**
+ * trace a reschedule skipped by a service called from an ISR2
+ * ** Function defined in os/tpl_trace.h **
+ *
+ */
+FUNC(void, OS_CODE)
+tpl_trace_schedule_deferred(CONST(tpl_proc_id, AUTOMATIC) proc_id)
+{
+  const uint8 first = tpl_trace_start();
+  const tpl_tick ts = tpl_trace_get_timestamp();
+#if TRACE_FORMAT == TRACE_FORMAT_JSON
+  if (!first)
+    fprintf(trace_file, ",");
+  fprintf(trace_file,
+          "\n\t{\n"
+          "\t\t\"type\":\"schedule\",\n"
+          "\t\t\"ts\":\"%u\",\n"
+          "\t\t\"kind\":\"deferred\",\n"
+          "\t\t\"proc_id\":\"%d\"\n"
+          "\t}",
+          ts, proc_id);
+#else
+#error "unsupported trace mode: TRACE_FORMAT"
+#endif
+}
+
+/**
+ * trace the election that ends a burst of ISR2
+ * ** Function defined in os/tpl_trace.h **
+ *
+ */
+FUNC(void, OS_CODE)
+tpl_trace_schedule_coalesced(CONST(uint16, AUTOMATIC) count)
+{
+  const uint8 first = tpl_trace_start();
+  const tpl_tick ts = tpl_trace_get_timestamp();
+#if TRACE_FORMAT == TRACE_FORMAT_JSON
+  if (!first)
+    fprintf(trace_file, ",");
+  fprintf(trace_file,
+          "\n\t{\n"
+          "\t\t\"type\":\"schedule\",\n"
+          "\t\t\"ts\":\"%u\",\n"
+          "\t\t\"kind\":\"coalesced\",\n"
+          "\t\t\"count\":\"%d\"\n"
+          "\t}",
+          ts, count);
+#else
+#error "unsupported trace mode: TRACE_FORMAT"
+#endif
+}
+#endif /* WITH_DEFERRED_SCHEDULE == YES */
+
+#if TRACE_SERVICES == YES
+/**
+ * trace the statistics of a service, sent by ShutdownOS
+ * ** Function defined in os/tpl_trace.h **
+ *
+ */
+FUNC(void, OS_CODE)
+tpl_trace_service_stats(CONST(OSServiceIdType, AUTOMATIC) service_id,
+                        P2CONST(ServiceStatsType, AUTOMATIC, OS_VAR) stats)
+{
+  const uint8 first = tpl_trace_start();
+  const tpl_tick ts = tpl_trace_get_timestamp();
+  int bucket;
+#if TRACE_FORMAT == TRACE_FORMAT_JSON
+  if (!first)
+    fprintf(trace_file, ",");
+  fprintf(trace_file,
+          "\n\t{\n"
+          "\t\t\"type\":\"service_stats\",\n"
+          "\t\t\"ts\":\"%u\",\n"
+          "\t\t\"service_id\":\"%d\",\n"
+          "\t\t\"count\":\"%u\",\n"
+          "\t\t\"min\":\"%u\",\n"
+          "\t\t\"max\":\"%u\",\n"
+          "\t\t\"histogram\":[",
+          ts, service_id, stats->count, stats->min, stats->max);
+  for (bucket = 0; bucket < SERVICE_STATS_BUCKET_COUNT; bucket++)
+  {
+    fprintf(trace_file, "%s%u", (bucket == 0) ? "" : ",",
+            stats->histogram[bucket]);
+  }
+  fprintf(trace_file, "]\n\t}");
+#else
+#error "unsupported trace mode: TRACE_FORMAT"
+#endif
+}
+#endif /* TRACE_SERVICES == YES */
+
 /**
  * trace the lock of a resource by an entity
  * ** Function defined in os/tpl_trace.h **
@@ -249,6 +249,19 @@ FUNC(uint8, OS_CODE) tpl_check_stack_footprint(
   CONST(tpl_proc_id, AUTOMATIC) proc_id);
 #endif /* WITH_AUTOSAR_STACK_MONITORING */
 
+#if WITH_CYCLE_COUNT == YES
+/**
+ * @internal
+ *
+ * Returns a free running cycle counter used to measure the durations of
+ * the services and the CPU time of the processes. Only differences between
+ * two values are used, the counter may wrap around.
+ *
+ * @return the current value of the counter
+ */
+extern FUNC(uint32, OS_CODE) tpl_get_cycle_count(void);
+#endif /* WITH_CYCLE_COUNT */
+
 #if NUMBER_OF_CORES > 1
 
 /**
@@ -0,0 +1,72 @@
+/*
+ * @file tpl_os_cpu_time.h
+ *
+ * @section desc File description
+ *
+ * Trampoline CPU Time Accounting header file
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline RTOS
+ *
+ * Trampoline is copyright (c) CNRS, University of Nantes, Ecole Centrale de Nantes
+ * Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the GNU Public Licence V2.
+ * Check the LICENSE file in the root directory of Trampoline
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+#ifndef TPL_OS_CPU_TIME_H
+#define TPL_OS_CPU_TIME_H
+
+#include "tpl_os_types.h"
+
+/**
+ * @struct TPL_CPU_TIME
+ *
+ * CPU time used by a task or an ISR2, in cycles of the target. The response
+ * time of an instance goes from its activation to its termination. When
+ * activations are queued, the next instance is considered activated when
+ * the previous one terminates.
+ */
+struct TPL_CPU_TIME
+{
+  VAR(uint64, TYPEDEF) execution_time;    /**< total time the proc has run */
+  VAR(uint32, TYPEDEF) response_time;     /**< of the last instance        */
+  VAR(uint32, TYPEDEF) max_response_time; /**< longest response time       */
+  VAR(uint32, TYPEDEF) preemption_count;  /**< number of preemptions       */
+};
+
+/**
+ * @typedef CpuTimeType
+ *
+ * This type is an alias for the #TPL_CPU_TIME structure.
+ *
+ * @see #TPL_CPU_TIME
+ */
+typedef struct TPL_CPU_TIME CpuTimeType;
+
+/**
+ * @typedef CpuTimeRefType
+ *
+ * References a #CpuTimeType
+ */
+typedef P2VAR(CpuTimeType, TYPEDEF, OS_APPL_DATA) CpuTimeRefType;
+
+/**
+ * @typedef CpuLoadRefType
+ *
+ * References a CPU load, in percent
+ */
+typedef P2VAR(uint8, TYPEDEF, OS_APPL_DATA) CpuLoadRefType;
+
+#endif /* TPL_OS_CPU_TIME_H */
+
+/* End of file tpl_os_cpu_time.h */
@@ -0,0 +1,235 @@
+/**
+ * @file tpl_os_cpu_time_kernel.c
+ *
+ * @section desc File description
+ *
+ * Trampoline CPU Time Accounting implementation file
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline RTOS
+ *
+ * Trampoline is copyright (c) CNRS, University of Nantes, Ecole Centrale de
+ * Nantes Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the GNU Public Licence V2.
+ * Check the LICENSE file in the root directory of Trampoline
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+#include "tpl_machine_interface.h"
+#include "tpl_os_definitions.h"
+#include "tpl_os_error.h"
+#include "tpl_os_errorhook.h"
+#include "tpl_os_kernel.h"
+#include "tpl_os_cpu_time_kernel.h"
+
+/*
+ * Largest elapsed time used to compute the load with 32 bits arithmetics
+ */
+#define CPU_LOAD_MAX_ELAPSED 0x00FFFFFFUL
+
+#define OS_START_SEC_VAR_32BIT
+#include "tpl_memmap.h"
+
+/*
+ * date of the last update of the CPU time of the running process
+ */
+STATIC VAR(uint32, OS_VAR) last_update;
+
+/*
+ * activation dates of the current instances of the processes
+ */
+STATIC VAR(uint32, OS_VAR) release_date[IDLE_TASK_ID + 1];
+
+#define OS_STOP_SEC_VAR_32BIT
+#include "tpl_memmap.h"
+
+#define OS_START_SEC_VAR_UNSPECIFIED
+#include "tpl_memmap.h"
+
+VAR(CpuTimeType, OS_VAR) tpl_cpu_time_table[IDLE_TASK_ID + 1];
+
+/*
+ * time elapsed since StartOS, and the elapsed and idle times at the
+ * beginning of the current load window
+ */
+STATIC VAR(uint64, OS_VAR) elapsed_time;
+STATIC VAR(uint64, OS_VAR) window_elapsed_time;
+STATIC VAR(uint64, OS_VAR) window_idle_time;
+
+#define OS_STOP_SEC_VAR_UNSPECIFIED
+#include "tpl_memmap.h"
+
+#define OS_START_SEC_CODE
+#include "tpl_memmap.h"
+
+/*
+ * tpl_cpu_time_update
+ */
+FUNC(void, OS_CODE) tpl_cpu_time_update(void)
+{
+  GET_CURRENT_CORE_ID(core_id)
+  GET_TPL_KERN_FOR_CORE_ID(core_id, kern)
+
+  CONST(uint32, AUTOMATIC) now = tpl_get_cycle_count();
+  CONST(uint32, AUTOMATIC) delta = now - last_update;
+
+  last_update = now;
+
+  /* nothing runs before the first process is started by StartOS */
+  if (TPL_KERN_REF(kern).running_id != INVALID_PROC_ID)
+  {
+    tpl_cpu_time_table[TPL_KERN_REF(kern).running_id].execution_time += delta;
+    elapsed_time += delta;
+  }
+}
+
+/*
+ * tpl_cpu_time_on_preempt
+ */
+FUNC(void, OS_CODE) tpl_cpu_time_on_preempt(
+  CONST(tpl_proc_id, AUTOMATIC) proc_id)
+{
+  tpl_cpu_time_table[proc_id].preemption_count++;
+}
+
+/*
+ * tpl_cpu_time_on_release
+ */
+FUNC(void, OS_CODE) tpl_cpu_time_on_release(
+  CONST(tpl_proc_id, AUTOMATIC) proc_id)
+{
+  release_date[proc_id] = tpl_get_cycle_count();
+}
+
+/*
+ * tpl_cpu_time_on_terminate
+ */
+FUNC(void, OS_CODE) tpl_cpu_time_on_terminate(
+  CONST(tpl_proc_id, AUTOMATIC) proc_id)
+{
+  CONST(uint32, AUTOMATIC) now = tpl_get_cycle_count();
+  CONST(uint32, AUTOMATIC) response_time = now - release_date[proc_id];
+  CONSTP2VAR(CpuTimeType, AUTOMATIC, OS_VAR)
+  cpu_time = &tpl_cpu_time_table[proc_id];
+
+  cpu_time->response_time = response_time;
+  if (response_time > cpu_time->max_response_time)
+  {
+    cpu_time->max_response_time = response_time;
+  }
+
+  /* a queued activation: the next instance is released now */
+  if (tpl_dyn_proc_table[proc_id]->activate_count > 0)
+  {
+    release_date[proc_id] = now;
+  }
+}
+
+/*
+ * tpl_get_task_cpu_time_service
+ */
+FUNC(tpl_status, OS_CODE) tpl_get_task_cpu_time_service(
+  CONST(tpl_task_id, AUTOMATIC)    task_id,
+  CONST(CpuTimeRefType, AUTOMATIC) cpu_time)
+{
+  GET_CURRENT_CORE_ID(core_id)
+
+  VAR(tpl_status, AUTOMATIC) result = E_OK;
+
+  LOCK_KERNEL()
+
+  /* check interrupts are not disabled by user    */
+  CHECK_INTERRUPT_LOCK(result)
+
+  STORE_SERVICE(OSServiceId_GetTaskCpuTime)
+  STORE_TASK_ID(task_id)
+
+  /* check cpu_time is in an authorized memory region */
+  CHECK_DATA_LOCATION(core_id, cpu_time, result);
+
+#if WITH_OS_EXTENDED == YES
+  /* tasks and ISR2 only, the idle time is given by GetCpuLoad */
+  if ((result == E_OK) &&
+      ((task_id >= (tpl_task_id)(IDLE_TASK_ID)) || (task_id < 0)))
+  {
+    result = E_OS_ID;
+  }
+#endif
+
+  IF_NO_EXTENDED_ERROR(result)
+  {
+    /* account the current slice of the caller */
+    tpl_cpu_time_update();
+    *cpu_time = tpl_cpu_time_table[task_id];
+  }
+
+  PROCESS_ERROR(result)
+
+  UNLOCK_KERNEL()
+
+  return result;
+}
+
+/*
+ * tpl_get_cpu_load_service
+ */
+FUNC(tpl_status, OS_CODE) tpl_get_cpu_load_service(
+  CONST(CpuLoadRefType, AUTOMATIC) load)
+{
+  GET_CURRENT_CORE_ID(core_id)
+
+  VAR(tpl_status, AUTOMATIC) result = E_OK;
+
+  LOCK_KERNEL()
+
+  /* check interrupts are not disabled by user    */
+  CHECK_INTERRUPT_LOCK(result)
+
+  STORE_SERVICE(OSServiceId_GetCpuLoad)
+
+  /* check load is in an authorized memory region */
+  CHECK_DATA_LOCATION(core_id, load, result);
+
+  IF_NO_EXTENDED_ERROR(result)
+  {
+    VAR(uint64, AUTOMATIC) elapsed;
+    VAR(uint64, AUTOMATIC) busy;
+
+    tpl_cpu_time_update();
+
+    elapsed = elapsed_time - window_elapsed_time;
+    busy = elapsed -
+           (tpl_cpu_time_table[IDLE_TASK_ID].execution_time - window_idle_time);
+
+    /* scale down to compute the percentage without a 64 bits division */
+    while (elapsed > CPU_LOAD_MAX_ELAPSED)
+    {
+      elapsed >>= 1;
+      busy >>= 1;
+    }
+    *load = (elapsed == 0) ? 0 : (uint8)(((uint32)busy * 100) / (uint32)elapsed);
+
+    /* the next load window starts now */
+    window_elapsed_time = elapsed_time;
+    window_idle_time = tpl_cpu_time_table[IDLE_TASK_ID].execution_time;
+  }
+
+  PROCESS_ERROR(result)
+
+  UNLOCK_KERNEL()
+
+  return result;
+}
+
+#define OS_STOP_SEC_CODE
+#include "tpl_memmap.h"
+
+/* End of file tpl_os_cpu_time_kernel.c */
@@ -0,0 +1,120 @@
+/**
+ * @file tpl_os_cpu_time_kernel.h
+ *
+ * @section desc File description
+ *
+ * Trampoline CPU Time Accounting kernel header file
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline RTOS
+ *
+ * Trampoline is copyright (c) CNRS, University of Nantes, Ecole Centrale de Nantes
+ * Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the GNU Public Licence V2.
+ * Check the LICENSE file in the root directory of Trampoline
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+#ifndef TPL_OS_CPU_TIME_KERNEL_H
+#define TPL_OS_CPU_TIME_KERNEL_H
+
+#include "tpl_os_types.h"
+#include "tpl_os_internal_types.h"
+#include "tpl_os_cpu_time.h"
+
+#define OS_START_SEC_VAR_UNSPECIFIED
+#include "tpl_memmap.h"
+
+/**
+ * @internal
+ *
+ * CPU time of the processes, indexed by proc id. The last entry is the idle
+ * task, its execution time is the idle time. Also read by the ORTI file.
+ */
+extern VAR(CpuTimeType, OS_VAR) tpl_cpu_time_table[IDLE_TASK_ID + 1];
+
+#define OS_STOP_SEC_VAR_UNSPECIFIED
+#include "tpl_memmap.h"
+
+#define OS_START_SEC_CODE
+#include "tpl_memmap.h"
+
+/**
+ * @internal
+ *
+ * Adds the time elapsed since the last update to the running process. It
+ * is called by tpl_run_elected before the running process changes and by
+ * tpl_counter_tick so that the time between two updates stays below the
+ * wrap around period of the cycle counter.
+ */
+FUNC(void, OS_CODE) tpl_cpu_time_update(void);
+
+/**
+ * @internal
+ *
+ * Counts a preemption of a process. Called by tpl_run_elected.
+ *
+ * @param proc_id   identifier of the preempted process
+ */
+FUNC(void, OS_CODE) tpl_cpu_time_on_preempt(
+  CONST(tpl_proc_id, AUTOMATIC) proc_id);
+
+/**
+ * @internal
+ *
+ * Records the activation date of a suspended process.
+ *
+ * @param proc_id   identifier of the activated process
+ */
+FUNC(void, OS_CODE) tpl_cpu_time_on_release(
+  CONST(tpl_proc_id, AUTOMATIC) proc_id);
+
+/**
+ * @internal
+ *
+ * Records the response time of the terminating instance of a process.
+ * Called by tpl_terminate once the activation count is updated.
+ *
+ * @param proc_id   identifier of the terminating process
+ */
+FUNC(void, OS_CODE) tpl_cpu_time_on_terminate(
+  CONST(tpl_proc_id, AUTOMATIC) proc_id);
+
+/**
+ * Get the CPU time of a task or an ISR2
+ *
+ * @param task_id   identifier of the task or of the ISR2
+ * @param cpu_time  reference to the structure where the CPU time is copied
+ *
+ * @retval  E_OK      no error
+ * @retval  E_OS_ID   (extended error only) task_id is invalid
+ */
+FUNC(tpl_status, OS_CODE) tpl_get_task_cpu_time_service(
+  CONST(tpl_task_id, AUTOMATIC)    task_id,
+  CONST(CpuTimeRefType, AUTOMATIC) cpu_time);
+
+/**
+ * Get the CPU load since the previous call, or since StartOS
+ *
+ * @param load  reference to the load, in percent of the time the CPU did
+ *              not run the idle task
+ *
+ * @retval  E_OK      no error
+ */
+FUNC(tpl_status, OS_CODE) tpl_get_cpu_load_service(
+  CONST(CpuLoadRefType, AUTOMATIC) load);
+
+#define OS_STOP_SEC_CODE
+#include "tpl_memmap.h"
+
+#endif /* TPL_OS_CPU_TIME_KERNEL_H */
+
+/* End of file tpl_os_cpu_time_kernel.h */
@@ -0,0 +1,52 @@
+/*
+ * @file tpl_os_event_group.h
+ *
+ * @section desc File description
+ *
+ * Trampoline Event Group header file
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline RTOS
+ *
+ * Trampoline is copyright (c) CNRS, University of Nantes, Ecole Centrale de Nantes
+ * Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the GNU Public Licence V2.
+ * Check the LICENSE file in the root directory of Trampoline
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+#ifndef TPL_OS_EVENT_GROUP_H
+#define TPL_OS_EVENT_GROUP_H
+
+#include "tpl_os_types.h"
+#include "tpl_os_event.h"
+
+/**
+ * @typedef EventGroupType
+ *
+ * identifies an event group, a static list of extended tasks the
+ * events are set to by a single SetEventGroup
+ */
+typedef uint8 EventGroupType;
+
+/**
+ * @def DeclareEventGroup
+ *
+ * defines an event group
+ *
+ * @param group_id C identifier of the event group
+ */
+#define DeclareEventGroup(group_id)  \
+extern CONST(EventGroupType, AUTOMATIC) group_id
+
+#endif /* TPL_OS_EVENT_GROUP_H */
+
+/* End of file tpl_os_event_group.h */
@@ -0,0 +1,125 @@
+/**
+ * @file tpl_os_event_group_kernel.c
+ *
+ * @section desc File description
+ *
+ * Trampoline Event Group implementation file
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline RTOS
+ *
+ * Trampoline is copyright (c) CNRS, University of Nantes, Ecole Centrale de
+ * Nantes Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the GNU Public Licence V2.
+ * Check the LICENSE file in the root directory of Trampoline
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+#include "tpl_machine_interface.h"
+#include "tpl_os_definitions.h"
+#include "tpl_os_error.h"
+#include "tpl_os_errorhook.h"
+#include "tpl_os_kernel.h"
+#include "tpl_os_event_group_kernel.h"
+
+#if WITH_AUTOSAR == YES
+#include "tpl_as_protec_hook.h"
+#endif
+
+#define OS_START_SEC_CODE
+#include "tpl_memmap.h"
+
+/*
+ * tpl_set_event_group_service
+ */
+FUNC(tpl_status, OS_CODE)
+tpl_set_event_group_service(CONST(EventGroupType, AUTOMATIC) group_id,
+                            CONST(tpl_event_mask, AUTOMATIC) event)
+{
+  GET_CURRENT_CORE_ID(core_id)
+
+  VAR(tpl_status, AUTOMATIC) result = E_OK;
+
+  LOCK_KERNEL()
+
+  /* check interrupts are not disabled by user    */
+  CHECK_INTERRUPT_LOCK(result)
+
+  STORE_SERVICE(OSServiceId_SetEventGroup)
+  STORE_EVENT_MASK(event)
+
+  /* Check call level error: forbidden from an alarm callback */
+  CHECK_CALLBACK_CALL_LEVEL_ERROR(result, core_id)
+
+#if WITH_OS_EXTENDED == YES
+  if ((result == E_OK) && (group_id >= EVENTGROUP_COUNT))
+  {
+    result = E_OS_ID;
+  }
+#endif
+
+#if (EVENTGROUP_COUNT > 0) && (WITH_OS_EXTENDED == YES) && \
+    (WITH_OSAPPLICATION == YES)
+  /*  check access right to every subscriber before any event is set, so
+      that a denied broadcast does not release part of the subscribers    */
+  if (result == E_OK)
+  {
+    CONSTP2CONST(tpl_event_group, AUTOMATIC, OS_CONST)
+    group = tpl_event_group_table[group_id];
+    VAR(tpl_task_id, AUTOMATIC) i;
+
+    for (i = 0; (result == E_OK) && (i < group->subscriber_count); i++)
+    {
+      CHECK_ACCESS_RIGHTS_TASK_ID(core_id, group->subscribers[i], result)
+    }
+  }
+#endif
+
+#if EVENTGROUP_COUNT > 0
+  IF_NO_EXTENDED_ERROR(result)
+  {
+    CONSTP2CONST(tpl_event_group, AUTOMATIC, OS_CONST)
+    group = tpl_event_group_table[group_id];
+    VAR(tpl_task_id, AUTOMATIC) i;
+
+    /*  tpl_set_event only puts the released tasks in the ready list,
+        suspended subscribers are skipped (E_OS_STATE is not an error
+        for a broadcast)                                                */
+    for (i = 0; i < group->subscriber_count; i++)
+    {
+      (void)tpl_set_event(group->subscribers[i], event);
+    }
+
+#if NUMBER_OF_CORES > 1
+    tpl_multi_schedule();
+    tpl_dispatch_context_switch();
+#endif
+    if (TPL_KERN(core_id).need_schedule && !DEFER_SCHEDULE())
+    {
+      tpl_schedule_from_running(CORE_ID_OR_NOTHING(core_id));
+      LOCAL_SWITCH_CONTEXT(core_id)
+    }
+  }
+#else
+  (void)group_id;
+#endif
+
+  PROCESS_ERROR(result)
+
+  UNLOCK_KERNEL()
+
+  return result;
+}
+
+#define OS_STOP_SEC_CODE
+#include "tpl_memmap.h"
+
+/* End of file tpl_os_event_group_kernel.c */
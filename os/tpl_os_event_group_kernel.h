@@ -0,0 +1,94 @@
+/**
+ * @file tpl_os_event_group_kernel.h
+ *
+ * @section desc File description
+ *
+ * Trampoline Event Group kernel header file
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline RTOS
+ *
+ * Trampoline is copyright (c) CNRS, University of Nantes, Ecole Centrale de Nantes
+ * Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the GNU Public Licence V2.
+ * Check the LICENSE file in the root directory of Trampoline
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+#ifndef TPL_OS_EVENT_GROUP_KERNEL_H
+#define TPL_OS_EVENT_GROUP_KERNEL_H
+
+#include "tpl_os_types.h"
+#include "tpl_os_event_group.h"
+
+/**
+ * @struct TPL_EVENT_GROUP
+ *
+ * An event group is the list of the extended tasks subscribed to it. The
+ * list is generated by goil.
+ */
+struct TPL_EVENT_GROUP
+{
+  CONSTP2CONST(tpl_task_id, TYPEDEF, OS_CONST)
+  subscribers; /**< ids of the subscribed tasks */
+  CONST(tpl_task_id, TYPEDEF)
+  subscriber_count; /**< number of subscribed tasks */
+};
+
+/**
+ * @typedef tpl_event_group
+ *
+ * This type is an alias for the #TPL_EVENT_GROUP structure.
+ *
+ * @see #TPL_EVENT_GROUP
+ */
+typedef struct TPL_EVENT_GROUP tpl_event_group;
+
+#define OS_START_SEC_CONST_UNSPECIFIED
+#include "tpl_memmap.h"
+
+#if EVENTGROUP_COUNT > 0
+/**
+ * The event groups, indexed by their id
+ */
+extern CONSTP2CONST(tpl_event_group, AUTOMATIC,
+                    OS_CONST) tpl_event_group_table[EVENTGROUP_COUNT];
+#endif
+
+#define OS_STOP_SEC_CONST_UNSPECIFIED
+#include "tpl_memmap.h"
+
+#define OS_START_SEC_CODE
+#include "tpl_memmap.h"
+
+/**
+ * Set events of all the tasks subscribed to an event group
+ *
+ * The event mask is merged into the events of each subscribed task that is
+ * not suspended, suspended tasks are skipped. The released tasks are put in
+ * the ready list and a single rescheduling is done at the end.
+ *
+ * @param   group_id    identifier of the event group
+ * @param   event       event mask for selected event bits
+ *
+ * @retval  E_OK        no error
+ * @retval  E_OS_ID     (extended error only) group_id is invalid
+ */
+FUNC(tpl_status, OS_CODE) tpl_set_event_group_service(
+    CONST(EventGroupType, AUTOMATIC)  group_id,
+    CONST(tpl_event_mask, AUTOMATIC)  event);
+
+#define OS_STOP_SEC_CODE
+#include "tpl_memmap.h"
+
+#endif /* TPL_OS_EVENT_GROUP_KERNEL_H */
+
+/* End of file tpl_os_event_group_kernel.h */
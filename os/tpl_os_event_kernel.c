@@ -86,7 +86,8 @@ tpl_set_event_service(CONST(tpl_task_id, AUTOMATIC) task_id,
   IF_NO_EXTENDED_ERROR(result)
   {
     result = tpl_set_event(task_id, event);
-    if (result == E_OK && TPL_KERN(proc_core_id).need_schedule)
+    if (result == E_OK && TPL_KERN(proc_core_id).need_schedule &&
+        !DEFER_SCHEDULE())
     {
       tpl_schedule_from_running(CORE_ID_OR_NOTHING(proc_core_id));
       SWITCH_CONTEXT(CORE_ID_OR_NOTHING(proc_core_id))
@@ -190,6 +191,52 @@ tpl_get_event_service(CONST(tpl_task_id, AUTOMATIC) task_id,
   return result;
 }
 
+#if (EXTENDED_TASK_COUNT > 0) && (WITH_SYSTEM_CALL == NO) &&                  \
+    (WITH_AUTOSAR_TIMING_PROTECTION == NO)
+/**
+ * @internal
+ *
+ * tpl_wait_event_fast returns immediately, without locking the kernel, when
+ * one of the events the running task waits for is already set. This is
+ * safe because only the task itself can clear its events: once seen, a set
+ * event stays set until the task calls ClearEvent.
+ *
+ * @param event   mask of the events waited for
+ *
+ * @retval  TRUE  one of the events is set, WaitEvent returns E_OK
+ * @retval  FALSE the task has to block or an error has to be reported, the
+ *                locked path is used
+ */
+STATIC FUNC(tpl_bool, OS_CODE)
+tpl_wait_event_fast(CONST(tpl_event_mask, AUTOMATIC) event)
+{
+  GET_CURRENT_CORE_ID(core_id)
+
+  VAR(tpl_status, AUTOMATIC) result = E_OK;
+  VAR(tpl_bool, AUTOMATIC) done = FALSE;
+
+  CHECK_INTERRUPT_LOCK(result)
+  CHECK_TASK_CALL_LEVEL_ERROR(core_id, result)
+  CHECK_NOT_EXTENDED_RUNNING_ERROR(core_id, result)
+  CHECK_RUNNING_OWNS_REZ_ERROR(core_id, result)
+  CHECK_SCHEDULE_WHILE_OCCUPED_SPINLOCK(core_id, result)
+
+  if (result == E_OK)
+  {
+    CONSTP2VAR(tpl_task_events, AUTOMATIC, OS_VAR)
+    task_events = tpl_task_events_table[TPL_KERN(core_id).running_id];
+
+    if ((task_events->evt_set & event) != 0)
+    {
+      task_events->evt_wait = event;
+      done = TRUE;
+    }
+  }
+
+  return done;
+}
+#endif
+
 /*
  * tpl_wait_event_service
  */
@@ -205,6 +252,14 @@ tpl_wait_event_service(CONST(tpl_event_mask, AUTOMATIC) event)
   CONSTP2VAR(tpl_task_events, AUTOMATIC, OS_VAR)
   task_events = tpl_task_events_table[TPL_KERN_REF(kern).running_id];
 
+#if (EXTENDED_TASK_COUNT > 0) && (WITH_SYSTEM_CALL == NO) &&                  \
+    (WITH_AUTOSAR_TIMING_PROTECTION == NO)
+  if (tpl_wait_event_fast(event) != FALSE)
+  {
+    return E_OK;
+  }
+#endif
+
   LOCK_KERNEL()
 
   /* check interrupts are not disabled by user    */
@@ -227,6 +282,7 @@ tpl_wait_event_service(CONST(tpl_event_mask, AUTOMATIC) event)
   {
     /* all the evt_wait is overidden. */
     task_events->evt_wait = event;
+    task_events->evt_get_clear = NULL;
 
 #if WITH_AUTOSAR_TIMING_PROTECTION == YES
     /* reset the execution budget */
@@ -262,6 +318,88 @@ tpl_wait_event_service(CONST(tpl_event_mask, AUTOMATIC) event)
   return result;
 }
 
+/*
+ * tpl_wait_get_clear_event_service
+ */
+FUNC(tpl_status, OS_CODE)
+tpl_wait_get_clear_event_service(
+  CONST(tpl_event_mask, AUTOMATIC) event,
+  CONSTP2VAR(tpl_event_mask, AUTOMATIC, OS_APPL_DATA) got_event)
+{
+  GET_CURRENT_CORE_ID(core_id)
+  GET_TPL_KERN_FOR_CORE_ID(core_id, kern)
+
+  VAR(tpl_status, AUTOMATIC) result = E_OK;
+
+  /* event mask of the caller */
+  CONSTP2VAR(tpl_task_events, AUTOMATIC, OS_VAR)
+  task_events = tpl_task_events_table[TPL_KERN_REF(kern).running_id];
+
+  LOCK_KERNEL()
+
+  /* check interrupts are not disabled by user    */
+  CHECK_INTERRUPT_LOCK(result)
+
+  STORE_SERVICE(OSServiceId_WaitGetClearEvent)
+  STORE_EVENT_MASK(event)
+
+  /*  WaitGetClearEvent cannot be called from ISR level  */
+  CHECK_TASK_CALL_LEVEL_ERROR(core_id, result)
+  /*  checks the calling task is an extended one  */
+  CHECK_NOT_EXTENDED_RUNNING_ERROR(core_id, result)
+  /*  checks the task does not occupy resource(s)   */
+  CHECK_RUNNING_OWNS_REZ_ERROR(core_id, result)
+  /*  checks the task does not occupy spinlock(s)   */
+  CHECK_SCHEDULE_WHILE_OCCUPED_SPINLOCK(core_id, result)
+
+  /* check got_event is in an authorized memory region */
+  CHECK_DATA_LOCATION(core_id, got_event, result);
+
+#if EXTENDED_TASK_COUNT > 0
+  IF_NO_EXTENDED_ERROR(result)
+  {
+    CONST(tpl_event_mask, AUTOMATIC) already_set = task_events->evt_set & event;
+
+    task_events->evt_wait = event;
+
+#if WITH_AUTOSAR_TIMING_PROTECTION == YES
+    /* reset the execution budget */
+    tpl_tp_on_terminate_or_wait(TPL_KERN_REF(kern).running_id);
+#endif /* WITH_AUTOSAR_TIMING_PROTECTION  == YES */
+
+    if (already_set == 0)
+    {
+      /* No event is set, the task blocks. The events are got and
+         cleared by tpl_set_event when the task is released          */
+      task_events->evt_get_clear = got_event;
+      tpl_block();
+    }
+    else
+    {
+      *got_event = already_set;
+      task_events->evt_set &= (tpl_event_mask)(~already_set);
+      TRACE_EVENT_RESET(already_set)
+#if WITH_AUTOSAR_TIMING_PROTECTION == YES
+      if (FALSE == tpl_tp_on_activate_or_release(TPL_KERN_REF(kern).running_id))
+      {
+        tpl_call_protection_hook(E_OS_PROTECTION_ARRIVAL);
+      }
+      else
+      {
+        tpl_tp_on_start(TPL_KERN_REF(kern).running_id);
+      }
+#endif /* WITH_AUTOSAR_TIMING_PROTECTION == YES */
+    }
+  }
+#endif
+
+  PROCESS_ERROR(result)
+
+  UNLOCK_KERNEL()
+
+  return result;
+}
+
 #define OS_STOP_SEC_CODE
 #include "tpl_memmap.h"
 
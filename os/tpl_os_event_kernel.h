@@ -103,6 +103,28 @@ FUNC(tpl_status, OS_CODE) tpl_wait_event_service(
     CONST(tpl_event_mask, AUTOMATIC) event);
 
 
+/**
+ * Waits for some bits in the event, then gets and clears the events that
+ * are set among them. This is equivalent to WaitEvent, GetEvent and
+ * ClearEvent called back to back with a single kernel entry.
+ *
+ * @param   event       event mask for selected event bits
+ * @param   got_event   #tpl_event_mask variable where the events of
+ *                      <event> that are set are stored before they are
+ *                      cleared
+ *
+ * @retval  E_OK            no error
+ * @retval  E_OS_ACCESS     (extended error only) calling task is not an
+ *                          extended task
+ * @retval  E_OS_RESOURCE   (extended error only) calling task occupies
+ *                          resources
+ * @retval  E_OS_CALLEVEL   (extended error only) call at interrupt level
+ */
+FUNC(tpl_status, OS_CODE) tpl_wait_get_clear_event_service(
+    CONST(tpl_event_mask, AUTOMATIC)                    event,
+    CONSTP2VAR(tpl_event_mask, AUTOMATIC, OS_APPL_DATA) got_event);
+
+
 #define OS_STOP_SEC_CODE
 #include "tpl_memmap.h"
 
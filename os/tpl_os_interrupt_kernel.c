@@ -244,6 +244,7 @@ FUNC(tpl_status, OS_CODE) tpl_terminate_isr2_service(void)
     TPL_KERN(core_id).need_switch = NEED_SWITCH;
     /* start the highest priority process */
     tpl_start(CORE_ID_OR_NOTHING(core_id));
+    END_DEFER_SCHEDULE()
 
     LOCAL_SWITCH_CONTEXT_NOSAVE(core_id)
   }
@@ -297,10 +298,17 @@ STATIC FUNC(void, OS_CODE) tpl_activate_isr(CONST(tpl_isr_id, AUTOMATIC) isr_id)
         {
           isr->state = (tpl_proc_state)READY_AND_NEW;
           TRACE_PROC_CHANGE_STATE(isr_id, READY_AND_NEW)
+#if WITH_CPU_TIME == YES
+          tpl_cpu_time_on_release(isr_id);
+#endif /* WITH_CPU_TIME */
         }
       }
       /*  put it in the list  */
       tpl_put_new_proc(isr_id);
+#if WITH_DEFERRED_SCHEDULE == YES
+      /*  the central interrupt handler only elects when needed  */
+      TPL_KERN(0).need_schedule = TRUE;
+#endif
       /*  inc the isr activation count. When the isr will terminate
           it will dec this count and if not zero it will be reactivated   */
       isr->activate_count++;
@@ -373,7 +381,11 @@ tpl_central_interrupt_handler(CONST(uint16, AUTOMATIC) isr_id)
 
     tpl_it_nesting--;
 
+#if WITH_DEFERRED_SCHEDULE == YES
+    if ((tpl_it_nesting == 0) && TPL_KERN(core_id).need_schedule)
+#else
     if (tpl_it_nesting == 0)
+#endif
     {
       tpl_schedule_from_running(CORE_ID_OR_NOTHING(core_id));
       LOCAL_SWITCH_CONTEXT(core_id)
@@ -415,7 +427,11 @@ tpl_fast_central_interrupt_handler(CONST(uint16, AUTOMATIC) isr_id)
 
     tpl_it_nesting--;
 
+#if WITH_DEFERRED_SCHEDULE == YES
+    if ((tpl_it_nesting == 0) && TPL_KERN(core_id).need_schedule)
+#else
     if (tpl_it_nesting == 0)
+#endif
     {
       tpl_schedule_from_running(CORE_ID_OR_NOTHING(core_id));
       LOCAL_SWITCH_CONTEXT(core_id)
@@ -149,6 +149,18 @@ INTERNAL_RES_SCHEDULER = {
 #define OS_STOP_SEC_VAR_UNSPECIFIED
 #include "tpl_memmap.h"
 
+#if WITH_DEFERRED_SCHEDULE == YES
+#define OS_START_SEC_VAR_16BIT
+#include "tpl_memmap.h"
+/*
+ * deferred_schedule_count is the number of reschedules skipped since the
+ * last election of a task.
+ */
+STATIC VAR(uint16, OS_VAR) deferred_schedule_count = 0;
+#define OS_STOP_SEC_VAR_16BIT
+#include "tpl_memmap.h"
+#endif
+
 #define OS_START_SEC_VAR_BOOLEAN
 #include "tpl_memmap.h"
 /*
@@ -195,6 +207,49 @@ FUNC(tpl_bool, OS_CODE) tpl_alarm_callback_running(void)
   return alarm_callback_running;
 }
 
+#if WITH_DEFERRED_SCHEDULE == YES
+/*
+ * @internal
+ *
+ * tpl_defer_schedule tells if the rescheduling of a service may be skipped.
+ * It is the case when the running process is an ISR2 since ISR2 priorities
+ * are above all the task priorities. need_schedule stays TRUE and the
+ * election is done by tpl_terminate_isr2_service.
+ */
+FUNC(tpl_bool, OS_CODE) tpl_defer_schedule(void)
+{
+  VAR(tpl_bool, AUTOMATIC) deferred = FALSE;
+
+  if ((tpl_kern.running_id >= TASK_COUNT) &&
+      (tpl_kern.running_id < (TASK_COUNT + ISR_COUNT)))
+  {
+    deferred = TRUE;
+    deferred_schedule_count++;
+    TRACE_SCHEDULE_DEFERRED(tpl_kern.running_id)
+  }
+
+  return deferred;
+}
+
+/*
+ * @internal
+ *
+ * tpl_end_deferred_schedule is called by tpl_terminate_isr2_service once the
+ * next process has been elected. The coalesced reschedules are traced when
+ * a task gets the CPU back.
+ */
+FUNC(void, OS_CODE) tpl_end_deferred_schedule(void)
+{
+  if ((deferred_schedule_count > 0) &&
+      ((tpl_kern.elected_id < TASK_COUNT) ||
+       (tpl_kern.elected_id >= (TASK_COUNT + ISR_COUNT))))
+  {
+    TRACE_SCHEDULE_COALESCED(deferred_schedule_count)
+    deferred_schedule_count = 0;
+  }
+}
+#endif /* WITH_DEFERRED_SCHEDULE */
+
 #ifdef WITH_DOW
 #include <stdio.h>
 
@@ -246,6 +301,89 @@ FUNC(void, OS_CODE) print_kern(P2VAR(char, AUTOMATIC, OS_APPL_DATA) msg)
 
 #endif
 
+#if WITH_EDF == YES
+/*
+ * @internal
+ *
+ * tpl_edf_time_left returns the number of ticks of the EDF counter between
+ * now and an absolute deadline. The dates wrap at the MAXALLOWEDVALUE of
+ * the counter, so a deadline more than half of the range away is taken
+ * as a missed deadline and the result is negative.
+ */
+STATIC FUNC(sint32, OS_CODE)
+tpl_edf_time_left(CONST(tpl_tick, AUTOMATIC) deadline)
+{
+  CONST(tpl_tick, AUTOMATIC) now = tpl_edf_counter->current_date;
+  CONST(tpl_tick, AUTOMATIC) range = tpl_edf_counter->max_allowed_value + 1;
+  VAR(tpl_tick, AUTOMATIC) left = deadline - now;
+
+  if (deadline < now)
+  {
+    left += range;
+  }
+  if (left > (tpl_edf_counter->max_allowed_value >> 1))
+  {
+    left -= range;
+  }
+
+  return (sint32)left;
+}
+
+/*
+ * @internal
+ *
+ * tpl_edf_earlier tells if the first job has an earlier deadline than the
+ * second one. A job of a process without deadline is later than any job
+ * with a deadline.
+ */
+STATIC FUNC(tpl_bool, OS_CODE)
+tpl_edf_earlier(CONSTP2CONST(tpl_heap_entry, AUTOMATIC, OS_VAR) first_entry,
+                CONSTP2CONST(tpl_heap_entry, AUTOMATIC, OS_VAR) second_entry)
+{
+  VAR(tpl_bool, AUTOMATIC) result = FALSE;
+
+  if (tpl_stat_proc_table[first_entry->id]->deadline != 0)
+  {
+    if (tpl_stat_proc_table[second_entry->id]->deadline == 0)
+    {
+      result = TRUE;
+    }
+    else
+    {
+      result = (tpl_edf_time_left(first_entry->deadline) <
+                tpl_edf_time_left(second_entry->deadline));
+    }
+  }
+
+  return result;
+}
+
+FUNC(tpl_bool, OS_CODE)
+tpl_edf_preempts(CONST(tpl_heap_entry, AUTOMATIC) entry,
+                 CONST(tpl_proc_id, AUTOMATIC) proc_id)
+{
+  CONSTP2CONST(tpl_proc, AUTOMATIC, OS_APPL_DATA)
+  proc = tpl_dyn_proc_table[proc_id];
+  VAR(tpl_heap_entry, AUTOMATIC) proc_entry;
+  VAR(tpl_bool, AUTOMATIC) result;
+
+  if ((entry.key & PRIORITY_MASK) == (proc->priority & PRIORITY_MASK))
+  {
+    /* same priority level, the earliest deadline wins, FIFO otherwise */
+    proc_entry.key = proc->priority;
+    proc_entry.id = proc_id;
+    proc_entry.deadline = proc->deadline;
+    result = tpl_edf_earlier(&entry, &proc_entry);
+  }
+  else
+  {
+    result = (entry.key > proc->priority);
+  }
+
+  return result;
+}
+#endif /* WITH_EDF */
+
 /*
  * Jobs are stored in a heap. Each entry has a key (used to sort the heap)
  * and the id of the process. The size of the heap is computed by doing
@@ -262,6 +400,9 @@ FUNC(void, OS_CODE) print_kern(P2VAR(char, AUTOMATIC, OS_APPL_DATA) msg)
  * the priority of a job
  * PRIORITY_SHIFT is used to shift the part of the key used to store
  * the priority of a job
+ *
+ * With the EDF scheduler, the jobs of the same priority are ordered by
+ * absolute deadline before the rank.
  */
 FUNC(int, OS_CODE)
 tpl_compare_entries(CONSTP2CONST(tpl_heap_entry, AUTOMATIC, OS_VAR) first_entry,
@@ -274,6 +415,7 @@ tpl_compare_entries(CONSTP2CONST(tpl_heap_entry, AUTOMATIC, OS_VAR) first_entry,
   second_key = second_entry->key & (PRIORITY_MASK | RANK_MASK);
   VAR(uint32, AUTOMATIC) first_tmp;
   VAR(uint32, AUTOMATIC) second_tmp;
+  VAR(int, AUTOMATIC) result;
 
   first_tmp = ((first_key & RANK_MASK) -
                TAIL_FOR_PRIO(tail_for_prio)[first_key >> PRIORITY_SHIFT]);
@@ -287,7 +429,23 @@ tpl_compare_entries(CONSTP2CONST(tpl_heap_entry, AUTOMATIC, OS_VAR) first_entry,
   second_key = (second_key & PRIORITY_MASK);
   second_key = second_key | second_tmp;
 
-  return (first_key < second_key);
+  result = (first_key < second_key);
+
+#if WITH_EDF == YES
+  if ((first_key & PRIORITY_MASK) == (second_key & PRIORITY_MASK))
+  {
+    if (tpl_edf_earlier(second_entry, first_entry))
+    {
+      result = TRUE;
+    }
+    else if (tpl_edf_earlier(first_entry, second_entry))
+    {
+      result = FALSE;
+    }
+  }
+#endif /* WITH_EDF */
+
+  return result;
 }
 
 /*
@@ -395,6 +553,17 @@ FUNC(void, OS_CODE) tpl_put_new_proc(CONST(tpl_proc_id, AUTOMATIC) proc_id)
 
   READY_LIST(ready_list)[index].key = dyn_prio;
   READY_LIST(ready_list)[index].id = proc_id;
+#if WITH_EDF == YES
+  /* the absolute deadline of the new job, modulo the range of the counter */
+  READY_LIST(ready_list)[index].deadline =
+      tpl_edf_counter->current_date + tpl_stat_proc_table[proc_id]->deadline;
+  if (READY_LIST(ready_list)[index].deadline >
+      tpl_edf_counter->max_allowed_value)
+  {
+    READY_LIST(ready_list)[index].deadline -=
+        tpl_edf_counter->max_allowed_value + 1;
+  }
+#endif /* WITH_EDF */
 
   tpl_bubble_up(READY_LIST(ready_list), index TAIL_FOR_PRIO_ARG(tail_for_prio));
 
@@ -427,6 +596,10 @@ tpl_put_preempted_proc(CONST(tpl_proc_id, AUTOMATIC) proc_id)
    */
   READY_LIST(ready_list)[index].key = dyn_prio;
   READY_LIST(ready_list)[index].id = proc_id;
+#if WITH_EDF == YES
+  READY_LIST(ready_list)[index].deadline =
+      tpl_dyn_proc_table[proc_id]->deadline;
+#endif /* WITH_EDF */
 
   tpl_bubble_up(READY_LIST(ready_list), index TAIL_FOR_PRIO_ARG(tail_for_prio));
 
@@ -680,6 +853,10 @@ tpl_run_elected(CONST(tpl_bool, AUTOMATIC) save)
     /* cancel the watchdog and update the budget                  */
     tpl_tp_on_preempt(TPL_KERN_REF(kern).running_id);
 #endif /* WITH_AUTOSAR_TIMING_PROTECTION */
+
+#if WITH_CPU_TIME == YES
+    tpl_cpu_time_on_preempt(TPL_KERN_REF(kern).running_id);
+#endif /* WITH_CPU_TIME */
   }
 
 #if WITH_ISR2_PRIORITY_MASKING == YES && ISR_COUNT > 0
@@ -706,6 +883,11 @@ tpl_run_elected(CONST(tpl_bool, AUTOMATIC) save)
   }
 #endif /* WITH_ISR2_PRIORITY_MASKING */
 
+#if WITH_CPU_TIME == YES
+  /* the running proc stops here, its CPU time is updated */
+  tpl_cpu_time_update();
+#endif /* WITH_CPU_TIME */
+
   /* copy the elected proc in running slot of tpl_kern */
   TPL_KERN_REF(kern).running = TPL_KERN_REF(kern).elected;
   TPL_KERN_REF(kern).s_running = TPL_KERN_REF(kern).s_elected;
@@ -773,6 +955,10 @@ FUNC(void, OS_CODE) tpl_start(CORE_ID_OR_VOID(core_id))
   TPL_KERN_REF(kern).elected_id = (uint32)proc.id;
   TPL_KERN_REF(kern).elected = tpl_dyn_proc_table[proc.id];
   TPL_KERN_REF(kern).s_elected = tpl_stat_proc_table[proc.id];
+#if WITH_EDF == YES
+  /* a task released from the waiting state starts a new job */
+  TPL_KERN_REF(kern).elected->deadline = proc.deadline;
+#endif /* WITH_EDF */
 
   if (TPL_KERN_REF(kern).elected->state == READY_AND_NEW)
   {
@@ -817,8 +1003,8 @@ FUNC(void, OS_CODE) tpl_schedule_from_running(CORE_ID_OR_VOID(core_id))
   tpl_check_stack((tpl_proc_id)TPL_KERN_REF(kern).elected_id);
 #endif /* WITH_STACK_MONITORING */
 
-  if ((READY_LIST(ready_list)[1].key) >
-      (tpl_dyn_proc_table[TPL_KERN_REF(kern).elected_id]->priority))
+  if (PREEMPTS_PROC(READY_LIST(ready_list)[1],
+                    TPL_KERN_REF(kern).elected_id))
   {
     /* Preempts the RUNNING task */
     tpl_preempt(CORE_ID_OR_NOTHING(core_id));
@@ -905,6 +1091,11 @@ FUNC(void, OS_CODE) tpl_terminate(void)
   tpl_tp_reset_watchdogs(TPL_KERN_REF(kern).running_id);
 #endif /* WITH_AUTOSAR_TIMING_PROTECTION */
 
+#if WITH_CPU_TIME == YES
+  /* the response time of the instance is known */
+  tpl_cpu_time_on_terminate(TPL_KERN_REF(kern).running_id);
+#endif /* WITH_CPU_TIME */
+
   /* copy it in old slot of tpl_kern */
   /*  TPL_KERN_REF(kern).old = TPL_KERN_REF(kern).running;
     TPL_KERN_REF(kern).s_old = TPL_KERN_REF(kern).s_running;*/
@@ -1009,6 +1200,9 @@ tpl_activate_task(CONST(tpl_task_id, AUTOMATIC) task_id)
             get the CPU as indicated by READY_AND_NEW state             */
         task->state = (tpl_proc_state)READY_AND_NEW;
         TRACE_PROC_CHANGE_STATE(task_id, (tpl_proc_state)READY_AND_NEW)
+#if WITH_CPU_TIME == YES
+        tpl_cpu_time_on_release(task_id);
+#endif /* WITH_CPU_TIME */
 
 #if EXTENDED_TASK_COUNT > 0
         /*  if the object is an extended task, init the events          */
@@ -1104,10 +1298,19 @@ tpl_set_event(CONST(tpl_task_id, AUTOMATIC) task_id,
     {
       /*  the task was waiting for at least one of the
           event set the wait mask is reset to 0         */
+      CONST(tpl_event_mask, AUTOMATIC) waited = events->evt_wait;
       events->evt_wait = (tpl_event_mask)0;
       /*  anyway check it is in the WAITING state       */
       if (task->state == (tpl_proc_state)WAITING)
       {
+        /*  WaitGetClearEvent: get and clear the events
+            on behalf of the released task              */
+        if (events->evt_get_clear != NULL)
+        {
+          *(events->evt_get_clear) = events->evt_set & waited;
+          events->evt_set &= (tpl_event_mask)(~waited);
+          events->evt_get_clear = NULL;
+        }
 #if WITH_AUTOSAR_TIMING_PROTECTION == YES
         /* a new instance is about to be activated: we need the agreement
          of the timing protection mechanism                                */
@@ -43,6 +43,14 @@
 #include "tpl_os_multicore.h"
 #endif
 
+#if WITH_SERVICE_STATS == YES
+#include "tpl_os_service_stats_kernel.h"
+#endif /* WITH_SERVICE_STATS */
+
+#if WITH_CPU_TIME == YES
+#include "tpl_os_cpu_time_kernel.h"
+#endif /* WITH_CPU_TIME */
+
 #include "tpl_os_multicore_macros.h"
 
 /**
@@ -201,6 +209,11 @@ struct TPL_PROC_STATIC
   max_activate_count; /**<  max activation count of a task/isr             */
   CONST(tpl_proc_type, TYPEDEF)
   type; /**<  TASK_BASIC,TASK_EXTENDED or IS_ROUTINE         */
+#if WITH_EDF == YES
+  CONST(tpl_tick, TYPEDEF)
+  deadline; /**<  relative deadline of the task in ticks of the
+                  EDF counter, 0 if the proc has no deadline     */
+#endif      /* WITH_EDF */
 #if WITH_AUTOSAR_TIMING_PROTECTION == YES
   CONST(tpl_time, TYPEDEF)
   executionbudget; /**<  execution budget                               */
@@ -242,6 +255,10 @@ struct TPL_PROC
   priority; /**< current priority                     */
   VAR(tpl_proc_state, TYPEDEF)
   state; /**< state (READY, RUNNING, ...)*/
+#if WITH_EDF == YES
+  VAR(tpl_tick, TYPEDEF)
+  deadline; /**< absolute deadline of the current job   */
+#endif      /* WITH_EDF */
 };
 
 /**
@@ -297,6 +314,9 @@ typedef struct
 {
   VAR(tpl_priority, TYPEDEF) key;
   VAR(tpl_proc_id, TYPEDEF) id;
+#if WITH_EDF == YES
+  VAR(tpl_tick, TYPEDEF) deadline; /**< absolute deadline of the job */
+#endif                             /* WITH_EDF */
 } tpl_heap_entry;
 
 #define OS_START_SEC_VAR_UNSPECIFIED
@@ -348,10 +368,21 @@ extern VAR(tpl_internal_resource, OS_VAR) INTERNAL_RES_SCHEDULER;
  * In multicore does the intercore interrupt if needed
  */
 #if WITH_SYSTEM_CALL == NO
+/*
+ * The measurement of a service ends when it switches the context, the
+ * time spent by the other processes is not counted.
+ */
+#if WITH_SERVICE_STATS == YES
+#define SERVICE_STATS_END() tpl_service_stats_end();
+#else
+#define SERVICE_STATS_END()
+#endif
+
 #define LOCAL_SWITCH_CONTEXT(a_core_id)                                        \
   if (TPL_KERN(a_core_id).need_switch != NO_NEED_SWITCH)                       \
   {                                                                            \
     TPL_KERN(a_core_id).need_switch = NO_NEED_SWITCH;                          \
+    SERVICE_STATS_END()                                                        \
     tpl_switch_context(tpl_run_elected(TRUE),                                  \
                        &(TPL_KERN(a_core_id).s_elected->context));             \
   }
@@ -360,6 +391,7 @@ extern VAR(tpl_internal_resource, OS_VAR) INTERNAL_RES_SCHEDULER;
   if (TPL_KERN(a_core_id).need_switch != NO_NEED_SWITCH)                       \
   {                                                                            \
     TPL_KERN(a_core_id).need_switch = NO_NEED_SWITCH;                          \
+    SERVICE_STATS_END()                                                        \
     tpl_switch_context(tpl_run_elected(FALSE),                                 \
                        &(TPL_KERN(a_core_id).s_elected->context));             \
   }
@@ -509,6 +541,14 @@ extern CONSTP2CONST(tpl_proc_static, AUTOMATIC, OS_APPL_DATA)
 extern CONSTP2VAR(tpl_proc, AUTOMATIC, OS_APPL_DATA)
     tpl_dyn_proc_table[TASK_COUNT + ISR_COUNT + NUMBER_OF_CORES];
 
+#if WITH_EDF == YES
+/**
+ * Counter giving the current date to compute and compare the absolute
+ * deadlines of the jobs with the EDF scheduler.
+ */
+extern CONSTP2CONST(struct TPL_COUNTER, AUTOMATIC, OS_VAR) tpl_edf_counter;
+#endif /* WITH_EDF */
+
 #define OS_STOP_SEC_CONST_UNSPECIFIED
 #include "tpl_memmap.h"
 
@@ -570,6 +610,26 @@ FUNC(void, OS_CODE) tpl_release(CONST(tpl_task_id, AUTOMATIC) task_id);
  */
 FUNC(tpl_heap_entry, OS_CODE) tpl_front_proc(CORE_ID_OR_VOID(core_id));
 
+#if WITH_EDF == YES
+/**
+ * @internal
+ *
+ * Tells if a job of the ready list should preempt a process. Jobs of
+ * the same priority level are compared by absolute deadline.
+ *
+ * @param entry     the job of the ready list
+ * @param proc_id   the process currently elected
+ */
+FUNC(tpl_bool, OS_CODE)
+tpl_edf_preempts(CONST(tpl_heap_entry, AUTOMATIC) entry,
+                 CONST(tpl_proc_id, AUTOMATIC) proc_id);
+
+#define PREEMPTS_PROC(a_entry, a_proc_id) tpl_edf_preempts(a_entry, a_proc_id)
+#else
+#define PREEMPTS_PROC(a_entry, a_proc_id) \
+  ((a_entry).key > tpl_dyn_proc_table[a_proc_id]->priority)
+#endif /* WITH_EDF */
+
 /**
  * @internal
  *
@@ -640,6 +700,33 @@ FUNC(tpl_status, OS_CODE)
 tpl_set_event(CONST(tpl_task_id, AUTOMATIC) task_id,
               CONST(tpl_event_mask, AUTOMATIC) incoming_event);
 
+#if WITH_DEFERRED_SCHEDULE == YES
+/**
+ * @internal
+ *
+ * tpl_defer_schedule returns TRUE when the running process is an ISR2.
+ * No task may preempt an ISR2, so a service called from an ISR2 leaves
+ * need_schedule set and the election is done once when the outermost
+ * ISR2 terminates.
+ */
+FUNC(tpl_bool, OS_CODE) tpl_defer_schedule(void);
+
+/**
+ * @internal
+ *
+ * tpl_end_deferred_schedule is called after the election done at the end
+ * of an ISR2. It traces how many reschedules have been coalesced when the
+ * elected process is no longer an ISR2.
+ */
+FUNC(void, OS_CODE) tpl_end_deferred_schedule(void);
+
+#define DEFER_SCHEDULE()      tpl_defer_schedule()
+#define END_DEFER_SCHEDULE()  tpl_end_deferred_schedule();
+#else
+#define DEFER_SCHEDULE()      FALSE
+#define END_DEFER_SCHEDULE()
+#endif /* WITH_DEFERRED_SCHEDULE */
+
 #if NUMBER_OF_CORES > 1
 /**
  * @internal
@@ -0,0 +1,64 @@
+/**
+ * @file tpl_os_mem_pool.h
+ *
+ * @section desc File description
+ *
+ * Trampoline Memory Pool header file
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline RTOS
+ *
+ * Trampoline is copyright (c) CNRS, University of Nantes, Ecole Centrale de Nantes
+ * Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the GNU Public Licence V2.
+ * Check the LICENSE file in the root directory of Trampoline
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+#ifndef TPL_OS_MEM_POOL_H
+#define TPL_OS_MEM_POOL_H
+
+#include "tpl_os_types.h"
+
+/**
+ * @typedef MemPoolType
+ *
+ * identifies a memory pool, a static set of blocks of the same size
+ */
+typedef uint8 MemPoolType;
+
+/**
+ * @typedef BlockRefType
+ *
+ * References a block of a memory pool
+ */
+typedef P2VAR(void, TYPEDEF, OS_APPL_DATA) BlockRefType;
+
+/**
+ * @typedef BlockRefRefType
+ *
+ * References a #BlockRefType
+ */
+typedef P2VAR(BlockRefType, TYPEDEF, OS_APPL_DATA) BlockRefRefType;
+
+/**
+ * @def DeclareMemPool
+ *
+ * defines a memory pool
+ *
+ * @param pool_id C identifier of the memory pool
+ */
+#define DeclareMemPool(pool_id)  \
+extern CONST(MemPoolType, AUTOMATIC) pool_id
+
+#endif /* TPL_OS_MEM_POOL_H */
+
+/* End of file tpl_os_mem_pool.h */
@@ -0,0 +1,171 @@
+/**
+ * @file tpl_os_mem_pool_kernel.c
+ *
+ * @section desc File description
+ *
+ * Trampoline Memory Pool implementation file
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline RTOS
+ *
+ * Trampoline is copyright (c) CNRS, University of Nantes, Ecole Centrale de
+ * Nantes Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the GNU Public Licence V2.
+ * Check the LICENSE file in the root directory of Trampoline
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+#include "tpl_machine_interface.h"
+#include "tpl_os_definitions.h"
+#include "tpl_os_error.h"
+#include "tpl_os_errorhook.h"
+#include "tpl_os_kernel.h"
+#include "tpl_os_mem_pool_kernel.h"
+
+#define OS_START_SEC_CODE
+#include "tpl_memmap.h"
+
+/*
+ * tpl_get_block_service
+ */
+FUNC(tpl_status, OS_CODE)
+tpl_get_block_service(CONST(MemPoolType, AUTOMATIC) pool_id,
+                      CONST(BlockRefRefType, AUTOMATIC) block)
+{
+  GET_CURRENT_CORE_ID(core_id)
+
+  VAR(tpl_status, AUTOMATIC) result = E_OK;
+
+  LOCK_KERNEL()
+
+  /* check interrupts are not disabled by user    */
+  CHECK_INTERRUPT_LOCK(result)
+
+  STORE_SERVICE(OSServiceId_GetBlock)
+
+  /* check block is in an authorized memory region */
+  CHECK_DATA_LOCATION(core_id, block, result);
+
+#if WITH_OS_EXTENDED == YES
+  if ((result == E_OK) && (pool_id >= MEMPOOL_COUNT))
+  {
+    result = E_OS_ID;
+  }
+#endif
+
+#if MEMPOOL_COUNT > 0
+  IF_NO_EXTENDED_ERROR(result)
+  {
+    CONSTP2VAR(tpl_mem_pool, AUTOMATIC, OS_VAR) pool =
+      tpl_mem_pool_table[pool_id];
+    CONSTP2VAR(tpl_mem_word, AUTOMATIC, OS_VAR) first_free = pool->free_list;
+
+    if (first_free != NULL)
+    {
+      pool->free_list = first_free->next;
+      *block = (BlockRefType)first_free;
+    }
+    else if (pool->fresh_index < pool->block_count)
+    {
+      *block = (BlockRefType)(pool->storage +
+                              (pool->fresh_index * pool->block_size));
+      pool->fresh_index++;
+    }
+    else
+    {
+      result = E_OS_LIMIT;
+    }
+  }
+#else
+  (void)pool_id;
+  (void)block;
+#endif
+
+  PROCESS_ERROR(result)
+
+  UNLOCK_KERNEL()
+
+  return result;
+}
+
+/*
+ * tpl_release_block_service
+ */
+FUNC(tpl_status, OS_CODE)
+tpl_release_block_service(CONST(MemPoolType, AUTOMATIC) pool_id,
+                          CONST(BlockRefType, AUTOMATIC) block)
+{
+  VAR(tpl_status, AUTOMATIC) result = E_OK;
+
+  LOCK_KERNEL()
+
+  /* check interrupts are not disabled by user    */
+  CHECK_INTERRUPT_LOCK(result)
+
+  STORE_SERVICE(OSServiceId_ReleaseBlock)
+
+#if WITH_OS_EXTENDED == YES
+  if ((result == E_OK) && (pool_id >= MEMPOOL_COUNT))
+  {
+    result = E_OS_ID;
+  }
+#endif
+
+#if MEMPOOL_COUNT > 0
+#if WITH_OS_EXTENDED == YES
+  /*  the block has to be the start of a block of the pool that has
+      already been allocated. A double release is not detected         */
+  if (result == E_OK)
+  {
+    CONSTP2CONST(tpl_mem_pool, AUTOMATIC, OS_VAR) pool =
+      tpl_mem_pool_table[pool_id];
+    CONSTP2CONST(uint8, AUTOMATIC, OS_VAR) start =
+      (P2CONST(uint8, AUTOMATIC, OS_VAR))pool->storage;
+    CONSTP2CONST(uint8, AUTOMATIC, OS_VAR) byte =
+      (P2CONST(uint8, AUTOMATIC, OS_VAR))block;
+    CONST(uint32, AUTOMATIC) block_bytes =
+      pool->block_size * (uint32)sizeof(tpl_mem_word);
+
+    if ((byte < start) ||
+        (byte >= (start + (pool->fresh_index * block_bytes))) ||
+        (((uint32)(byte - start) % block_bytes) != 0))
+    {
+      result = E_OS_VALUE;
+    }
+  }
+#endif
+
+  IF_NO_EXTENDED_ERROR(result)
+  {
+    CONSTP2VAR(tpl_mem_pool, AUTOMATIC, OS_VAR) pool =
+      tpl_mem_pool_table[pool_id];
+    CONSTP2VAR(tpl_mem_word, AUTOMATIC, OS_VAR) released =
+      (P2VAR(tpl_mem_word, AUTOMATIC, OS_VAR))block;
+
+    released->next = pool->free_list;
+    pool->free_list = released;
+  }
+#else
+  (void)pool_id;
+  (void)block;
+#endif
+
+  PROCESS_ERROR(result)
+
+  UNLOCK_KERNEL()
+
+  return result;
+}
+
+#define OS_STOP_SEC_CODE
+#include "tpl_memmap.h"
+
+/* End of file tpl_os_mem_pool_kernel.c */
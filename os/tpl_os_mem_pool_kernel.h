@@ -0,0 +1,134 @@
+/**
+ * @file tpl_os_mem_pool_kernel.h
+ *
+ * @section desc File description
+ *
+ * Trampoline Memory Pool kernel header file
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline RTOS
+ *
+ * Trampoline is copyright (c) CNRS, University of Nantes, Ecole Centrale de Nantes
+ * Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the GNU Public Licence V2.
+ * Check the LICENSE file in the root directory of Trampoline
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+#ifndef TPL_OS_MEM_POOL_KERNEL_H
+#define TPL_OS_MEM_POOL_KERNEL_H
+
+#include "tpl_os_types.h"
+#include "tpl_os_mem_pool.h"
+
+/**
+ * @union TPL_MEM_WORD
+ *
+ * Unit of the storage of the memory pools. A free block holds the link to
+ * the next free block in its first word.
+ */
+union TPL_MEM_WORD
+{
+  P2VAR(union TPL_MEM_WORD, TYPEDEF, OS_VAR) next; /**< next free block */
+  VAR(uint32, TYPEDEF) value;
+};
+
+/**
+ * @typedef tpl_mem_word
+ *
+ * This type is an alias for the #TPL_MEM_WORD union.
+ *
+ * @see #TPL_MEM_WORD
+ */
+typedef union TPL_MEM_WORD tpl_mem_word;
+
+/**
+ * @struct TPL_MEM_POOL
+ *
+ * A memory pool is a static storage of block_count blocks generated by goil.
+ * The blocks that have been released are chained in free_list. The blocks
+ * from fresh_index to the end of the storage have never been allocated, so
+ * no initialization of the free list is needed at startup.
+ */
+struct TPL_MEM_POOL
+{
+  CONSTP2VAR(tpl_mem_word, TYPEDEF, OS_VAR)
+  storage;                                /**< first block of the pool       */
+  CONST(uint32, TYPEDEF) block_size;      /**< in tpl_mem_word               */
+  CONST(uint32, TYPEDEF) block_count;     /**< number of blocks              */
+  P2VAR(tpl_mem_word, TYPEDEF, OS_VAR)
+  free_list;                              /**< released blocks               */
+  VAR(uint32, TYPEDEF) fresh_index;       /**< first never allocated block   */
+};
+
+/**
+ * @typedef tpl_mem_pool
+ *
+ * This type is an alias for the #TPL_MEM_POOL structure.
+ *
+ * @see #TPL_MEM_POOL
+ */
+typedef struct TPL_MEM_POOL tpl_mem_pool;
+
+#define OS_START_SEC_CONST_UNSPECIFIED
+#include "tpl_memmap.h"
+
+#if MEMPOOL_COUNT > 0
+/**
+ * The memory pools, indexed by their id
+ */
+extern CONSTP2VAR(tpl_mem_pool, AUTOMATIC,
+                  OS_VAR) tpl_mem_pool_table[MEMPOOL_COUNT];
+#endif
+
+#define OS_STOP_SEC_CONST_UNSPECIFIED
+#include "tpl_memmap.h"
+
+#define OS_START_SEC_CODE
+#include "tpl_memmap.h"
+
+/**
+ * Get a block from a memory pool
+ *
+ * The last released block is given first. When no block has been released,
+ * the next never allocated block is given.
+ *
+ * @param   pool_id     identifier of the memory pool
+ * @param   block       where the address of the block is stored
+ *
+ * @retval  E_OK        no error
+ * @retval  E_OS_LIMIT  all the blocks of the pool are allocated
+ * @retval  E_OS_ID     (extended error only) pool_id is invalid
+ */
+FUNC(tpl_status, OS_CODE) tpl_get_block_service(
+    CONST(MemPoolType, AUTOMATIC)     pool_id,
+    CONST(BlockRefRefType, AUTOMATIC) block);
+
+/**
+ * Give a block back to its memory pool
+ *
+ * @param   pool_id     identifier of the memory pool
+ * @param   block       the block, got from the same pool
+ *
+ * @retval  E_OK        no error
+ * @retval  E_OS_ID     (extended error only) pool_id is invalid
+ * @retval  E_OS_VALUE  (extended error only) block is not a block of the pool
+ */
+FUNC(tpl_status, OS_CODE) tpl_release_block_service(
+    CONST(MemPoolType, AUTOMATIC)     pool_id,
+    CONST(BlockRefType, AUTOMATIC)    block);
+
+#define OS_STOP_SEC_CODE
+#include "tpl_memmap.h"
+
+#endif /* TPL_OS_MEM_POOL_KERNEL_H */
+
+/* End of file tpl_os_mem_pool_kernel.h */
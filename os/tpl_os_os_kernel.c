@@ -180,6 +180,9 @@ tpl_call_shutdown_os(CONST(tpl_status, AUTOMATIC) error /*@unused@*/)
   CALL_OSAPPLICATION_SHUTDOWN_HOOKS()
 
   CALL_SHUTDOWN_HOOK(error)
+#if WITH_SERVICE_STATS == YES
+  tpl_service_stats_dump();
+#endif
   TRACE_CLOSE()
 
 #if SPINLOCK_COUNT > 0
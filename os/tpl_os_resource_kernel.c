@@ -113,6 +113,143 @@ tpl_release_all_resources(CONST(tpl_proc_id, AUTOMATIC) proc_id)
   }
 }
 
+#if (WITH_RESOURCE_FAST_PATH == YES) && (RESOURCE_COUNT > 0)
+/**
+ * @internal
+ *
+ * tpl_get_resource_fast gets a resource used by tasks only. Getting such a
+ * resource never triggers a rescheduling, so the checks and the linking of
+ * the resource are done without locking the kernel. Only the priority raise
+ * is done with the kernel locked: DYNAMIC_PRIO takes the rank of the task
+ * from tail_for_prio, which an interrupt activating a task of the ceiling
+ * level updates too. As in the locked path, the task then stays in front
+ * of the tasks activated at this level while it holds the resource.
+ *
+ * @param res_id  identifier of the resource
+ *
+ * @retval  TRUE  the resource has been got
+ * @retval  FALSE the slow path has to be used, either because the resource
+ *                is also used by an ISR or because an error has to be
+ *                reported.
+ */
+STATIC FUNC(tpl_bool, OS_CODE)
+tpl_get_resource_fast(CONST(tpl_resource_id, AUTOMATIC) res_id)
+{
+  GET_CURRENT_CORE_ID(core_id)
+  GET_TPL_KERN_FOR_CORE_ID(core_id, kern)
+
+  VAR(tpl_status, AUTOMATIC) result = E_OK;
+  VAR(tpl_bool, AUTOMATIC) done = FALSE;
+
+  CHECK_INTERRUPT_LOCK(result)
+
+  STORE_SERVICE(OSServiceId_GetResource)
+  STORE_RESOURCE_ID(res_id)
+
+  CHECK_CALLBACK_CALL_LEVEL_ERROR(result, core_id)
+  CHECK_RESOURCE_ID_ERROR(res_id, result)
+
+  if (result == E_OK)
+  {
+    CONSTP2VAR(tpl_resource, AUTOMATIC, OS_APPL_DATA)
+    res = TPL_RESOURCE_TABLE(core_id)[res_id];
+
+    CHECK_RESOURCE_PRIO_ERROR_ON_GET(core_id, res, result)
+
+    if ((result == E_OK) && (res->fast_path != FALSE))
+    {
+      CONSTP2VAR(tpl_proc, AUTOMATIC, OS_APPL_DATA)
+      running = TPL_KERN_REF(kern).running;
+      CONST(tpl_priority, AUTOMATIC) prev_priority = running->priority;
+
+      if (ACTUAL_PRIO(prev_priority) < res->ceiling_priority)
+      {
+        GET_TAIL_FOR_PRIO(core_id, tail_for_prio)
+        LOCK_KERNEL()
+        running->priority =
+          DYNAMIC_PRIO(res->ceiling_priority, tail_for_prio);
+        UNLOCK_KERNEL()
+      }
+
+      res->owner_prev_priority = prev_priority;
+      res->owner = (tpl_proc_id)TPL_KERN_REF(kern).running_id;
+      res->next_res = running->resources;
+      running->resources = res;
+      done = TRUE;
+    }
+  }
+
+  return done;
+}
+
+/**
+ * @internal
+ *
+ * tpl_release_resource_fast releases a resource used by tasks only without
+ * locking the kernel. The resource is unlinked while the task still runs at
+ * the ceiling priority, then the previous priority is restored by a single
+ * store. The kernel is locked to reschedule only if a ready task has a
+ * higher priority than the restored one. A task activated by an interrupt
+ * after the store preempts the running task when the interrupt returns.
+ *
+ * @param res_id  identifier of the resource
+ *
+ * @retval  TRUE  the resource has been released
+ * @retval  FALSE the slow path has to be used
+ */
+STATIC FUNC(tpl_bool, OS_CODE)
+tpl_release_resource_fast(CONST(tpl_resource_id, AUTOMATIC) res_id)
+{
+  GET_CURRENT_CORE_ID(core_id)
+  GET_TPL_KERN_FOR_CORE_ID(core_id, kern)
+
+  VAR(tpl_status, AUTOMATIC) result = E_OK;
+  VAR(tpl_bool, AUTOMATIC) done = FALSE;
+
+  CHECK_INTERRUPT_LOCK(result)
+
+  STORE_SERVICE(OSServiceId_ReleaseResource)
+  STORE_RESOURCE_ID(res_id)
+
+  CHECK_CALLBACK_CALL_LEVEL_ERROR(result, core_id)
+  CHECK_RESOURCE_ID_ERROR(res_id, result)
+
+  if (result == E_OK)
+  {
+    CONSTP2VAR(tpl_resource, AUTOMATIC, OS_APPL_DATA)
+    res = TPL_RESOURCE_TABLE(core_id)[res_id];
+
+    CHECK_RESOURCE_PRIO_ERROR_ON_RELEASE(core_id, res, result)
+    CHECK_RESOURCE_ORDER_ON_RELEASE(core_id, res, result)
+
+    if ((result == E_OK) && (res->fast_path != FALSE))
+    {
+      CONSTP2VAR(tpl_proc, AUTOMATIC, OS_APPL_DATA)
+      running = TPL_KERN_REF(kern).running;
+
+      running->resources = res->next_res;
+      res->next_res = NULL;
+      res->owner = INVALID_TASK;
+      running->priority = res->owner_prev_priority;
+
+      /*  tpl_front_proc is not inlined, the ready list is read after the
+          priority has been restored                                        */
+      if (PREEMPTS_PROC(tpl_front_proc(CORE_ID_OR_NOTHING(core_id)),
+                        TPL_KERN_REF(kern).running_id))
+      {
+        LOCK_KERNEL()
+        tpl_schedule_from_running(CORE_ID_OR_NOTHING(core_id));
+        LOCAL_SWITCH_CONTEXT(core_id)
+        UNLOCK_KERNEL()
+      }
+      done = TRUE;
+    }
+  }
+
+  return done;
+}
+#endif /* WITH_RESOURCE_FAST_PATH && RESOURCE_COUNT */
+
 /*
  * Getting a resource.
  *
@@ -133,6 +270,13 @@ tpl_get_resource_service(CONST(tpl_resource_id, AUTOMATIC) res_id)
   P2VAR(tpl_resource, AUTOMATIC, OS_APPL_DATA) res;
 #endif
 
+#if (WITH_RESOURCE_FAST_PATH == YES) && (RESOURCE_COUNT > 0)
+  if (tpl_get_resource_fast(res_id) != FALSE)
+  {
+    return E_OK;
+  }
+#endif
+
   LOCK_KERNEL()
 
   /* check interrupts are not disabled by user    */
@@ -219,6 +363,13 @@ tpl_release_resource_service(CONST(tpl_resource_id, AUTOMATIC) res_id)
 
   P2VAR(tpl_resource, AUTOMATIC, OS_APPL_DATA) res;
 
+#if (WITH_RESOURCE_FAST_PATH == YES) && (RESOURCE_COUNT > 0)
+  if (tpl_release_resource_fast(res_id) != FALSE)
+  {
+    return E_OK;
+  }
+#endif
+
   LOCK_KERNEL()
 
   /* check interrupts are not disabled by user    */
@@ -59,6 +59,12 @@ struct TPL_RESOURCE
 #if WITH_ID == YES
   CONST(tpl_resource_id, TYPEDEF)
   res_id; /**< Index of the resource in the resource table */
+#endif
+#if WITH_RESOURCE_FAST_PATH == YES
+  CONST(tpl_bool, TYPEDEF)
+  fast_path; /**< TRUE if the resource is used by tasks only. The
+                  kernel is then locked only to raise the priority
+                  of the task and to reschedule                 */
 #endif
   struct P2VAR(TPL_RESOURCE, TYPEDEF,
                OS_APPL_DATA) next_res; /**< Pointer to the next resource used to
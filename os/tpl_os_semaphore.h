@@ -27,9 +27,40 @@
 #define TPL_OS_SEMAPHORE_H
 
 #include "tpl_os_std_types.h"
+#include "tpl_os_types.h"
 
 typedef uint8 SemType;
 
-#define DeclareSemaphore(sem_id) extern CONST(SemType, AUTOMATIC) sem_id;
+/**
+ * @typedef SemWaitStatusType
+ *
+ * Outcome of a SemTimedWait. The status is written by the kernel when
+ * the calling task gets the token or when the timeout expires, so it
+ * is valid once SemTimedWait returns E_OK.
+ */
+typedef uint8 SemWaitStatusType;
+
+/**
+ * @typedef SemWaitStatusRefType
+ *
+ * References a #SemWaitStatusType
+ */
+typedef P2VAR(SemWaitStatusType, TYPEDEF, OS_APPL_DATA) SemWaitStatusRefType;
+
+/**
+ * @def SEM_ACQUIRED
+ *
+ * The calling task got a token of the semaphore
+ */
+#define SEM_ACQUIRED  0
+
+/**
+ * @def SEM_TIMEOUT
+ *
+ * The timeout expired before a token was posted to the calling task
+ */
+#define SEM_TIMEOUT   1
+
+#define DeclareSemaphore(sem_id) extern CONST(SemType, AUTOMATIC) sem_id
 
 #endif
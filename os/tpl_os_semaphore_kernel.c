@@ -29,37 +29,171 @@
 #include "tpl_os_error.h"
 #include "tpl_machine_interface.h"
 
+#if WITH_SEM_TIMEDWAIT == YES
+/*
+ * The waiter of each task, used when the task is blocked by SemTimedWait
+ */
+VAR(tpl_sem_waiter, OS_VAR) tpl_sem_waiters[TASK_COUNT];
+#endif
+
 FUNC(void, OS_CODE) tpl_sem_enqueue(
   P2VAR(tpl_semaphore, AUTOMATIC, OS_APPL_DATA) sem,
   CONST(tpl_task_id, AUTOMATIC)                 task_id)
 {
-  sem->size++;
-  sem->waiting_tasks[sem->index] = task_id;
-  sem->index++;
-  if (sem->index == TASK_COUNT)
+  VAR(uint32, AUTOMATIC) pos;
+  VAR(tpl_priority, AUTOMATIC) prio;
+
+  if (sem->queuing == SEM_PRIORITY_QUEUING)
+  {
+    /*
+     * Insert the task below the tasks of the same or higher priority so
+     * that the tasks of the same priority are released in FIFO order.
+     */
+    prio = tpl_stat_proc_table[task_id]->base_priority;
+    pos = sem->size;
+    while ((pos > 0) &&
+           (tpl_stat_proc_table[sem->waiting_tasks[pos - 1]]->base_priority >= prio))
+    {
+      sem->waiting_tasks[pos] = sem->waiting_tasks[pos - 1];
+      pos--;
+    }
+    sem->waiting_tasks[pos] = task_id;
+    sem->size++;
+  }
+  else
   {
-    sem->index = 0;
+    sem->size++;
+    sem->waiting_tasks[sem->index] = task_id;
+    sem->index++;
+    if (sem->index == TASK_COUNT)
+    {
+      sem->index = 0;
+    }
   }
 }
 
 FUNC(tpl_task_id, OS_CODE) tpl_sem_dequeue(
   P2VAR(tpl_semaphore, AUTOMATIC, OS_APPL_DATA) sem)
 {
-  VAR(uint32, AUTOMATIC) read_index = sem->index - sem->size;
-  VAR(tpl_task_id, AUTOMATIC) task_id;
+  VAR(uint32, AUTOMATIC) read_index;
 
-  if (sem->index < sem->size)
+  if (sem->queuing == SEM_PRIORITY_QUEUING)
   {
-    read_index += TASK_COUNT;
+    read_index = sem->size - 1;
+  }
+  else
+  {
+    read_index = sem->index - sem->size;
+    if (sem->index < sem->size)
+    {
+      read_index += TASK_COUNT;
+    }
   }
-  task_id = sem->waiting_tasks[read_index];
   sem->size--;
 
-  /* release the task */
-  tpl_release(task_id);
+  return sem->waiting_tasks[read_index];
+}
+
+#if WITH_SEM_TIMEDWAIT == YES
+/*
+ * tpl_sem_remove removes a task from the waiting tasks of a semaphore
+ * when its timeout expires. The tasks waiting after it are moved one
+ * slot back.
+ */
+FUNC(void, OS_CODE) tpl_sem_remove(
+  P2VAR(tpl_semaphore, AUTOMATIC, OS_APPL_DATA) sem,
+  CONST(tpl_task_id, AUTOMATIC)                 task_id)
+{
+  VAR(uint32, AUTOMATIC) pos;
+  VAR(uint32, AUTOMATIC) next;
+  VAR(uint32, AUTOMATIC) count = sem->size;
+
+  if (sem->queuing == SEM_PRIORITY_QUEUING)
+  {
+    pos = 0;
+  }
+  else
+  {
+    pos = sem->index - sem->size;
+    if (sem->index < sem->size)
+    {
+      pos += TASK_COUNT;
+    }
+  }
+
+  /* look for the task */
+  while ((count > 0) && (sem->waiting_tasks[pos] != task_id))
+  {
+    pos++;
+    if (pos == TASK_COUNT)
+    {
+      pos = 0;
+    }
+    count--;
+  }
+
+  if (count > 0)
+  {
+    /* and move the following ones */
+    count--;
+    while (count > 0)
+    {
+      next = pos + 1;
+      if (next == TASK_COUNT)
+      {
+        next = 0;
+      }
+      sem->waiting_tasks[pos] = sem->waiting_tasks[next];
+      pos = next;
+      count--;
+    }
+    sem->size--;
+    if (sem->queuing != SEM_PRIORITY_QUEUING)
+    {
+      sem->index = pos;
+    }
+  }
+}
+
+/*
+ * tpl_sem_stop_timeout is called when a task waiting for a semaphore
+ * gets a token. If the task called SemTimedWait, its timeout is cancelled.
+ */
+FUNC(void, OS_CODE) tpl_sem_stop_timeout(CONST(tpl_task_id, AUTOMATIC) task_id)
+{
+  CONSTP2VAR(tpl_sem_waiter, AUTOMATIC, OS_VAR) waiter = &tpl_sem_waiters[task_id];
+  P2VAR(tpl_time_obj, AUTOMATIC, OS_APPL_DATA) time_obj = &waiter->timeout;
+
+  if (waiter->sem != NULL)
+  {
+    TPL_UPDATE_COUNTERS(time_obj);
+    if (time_obj->state == (tpl_time_obj_state)TIME_OBJ_ACTIVE)
+    {
+      tpl_remove_time_obj(time_obj);
+      time_obj->state = TIME_OBJ_SLEEP;
+    }
+    TPL_ENABLE_SHAREDSOURCE(time_obj);
+    *(waiter->status) = SEM_ACQUIRED;
+    waiter->sem = NULL;
+  }
+}
 
-  return task_id;
+FUNC(void, OS_CODE) tpl_sem_timeout_expire(
+  P2VAR(tpl_time_obj, AUTOMATIC, OS_APPL_DATA) time_obj)
+{
+  CONSTP2VAR(tpl_sem_waiter, AUTOMATIC, OS_VAR) waiter =
+    (P2VAR(tpl_sem_waiter, AUTOMATIC, OS_VAR))time_obj;
+
+  if (waiter->sem != NULL)
+  {
+    tpl_sem_remove(waiter->sem, waiter->task_id);
+    *(waiter->status) = SEM_TIMEOUT;
+    waiter->sem = NULL;
+    /* the rescheduling is done by the caller of tpl_counter_tick */
+    tpl_release(waiter->task_id);
+  }
 }
+#endif
 
 #if WITH_DOW == YES
 #include <stdio.h>
@@ -71,7 +205,11 @@ FUNC(void, OS_CODE) tpl_sem_print(CONST(SemType, AUTOMATIC) sem_id)
   VAR(uint32, AUTOMATIC) count = sem->size;
 
   printf("(%lu)", sem->token);
-  if (sem->index < sem->size)
+  if (sem->queuing == SEM_PRIORITY_QUEUING)
+  {
+    index = 0;
+  }
+  else if (sem->index < sem->size)
   {
     index += TASK_COUNT;
   }
@@ -102,64 +240,175 @@ FUNC(tpl_status, OS_CODE) tpl_sem_wait_service(CONST(SemType, AUTOMATIC) sem_id)
   VAR(tpl_status, AUTOMATIC) result = E_OK;
   VAR(tpl_task_id, AUTOMATIC) task_id;
   P2CONST(tpl_proc_static, AUTOMATIC, OS_APPL_DATA)  s_task;
-  CONSTP2VAR(tpl_semaphore, AUTOMATIC, OS_CONST) sem = tpl_sem_table[sem_id];
+  P2VAR(tpl_semaphore, AUTOMATIC, OS_CONST) sem;
 
   LOCK_KERNEL()
 
-  task_id = TPL_KERN_REF(kern).running_id;
-  s_task = tpl_stat_proc_table[task_id];
-  if (s_task->max_activate_count == 1)
+#if WITH_OS_EXTENDED == YES
+  if (sem_id >= SEMAPHORE_COUNT)
   {
-    if (sem->token == 0)
+    result = E_OS_ID;
+  }
+#endif
+
+  IF_NO_EXTENDED_ERROR(result)
+  {
+    sem = tpl_sem_table[sem_id];
+    task_id = TPL_KERN_REF(kern).running_id;
+    s_task = tpl_stat_proc_table[task_id];
+    if (s_task->max_activate_count == 1)
     {
-      tpl_sem_enqueue(sem, task_id);
-      /* block the running task */
-      tpl_block();
+      if (sem->token == 0)
+      {
+        tpl_sem_enqueue(sem, task_id);
+        /* block the running task */
+        tpl_block();
+      }
+      else
+      {
+        sem->token--;
+      }
     }
     else
     {
-      sem->token--;
+      result = E_OS_ACCESS;
     }
   }
-  else
-  {
-    result = E_OS_ACCESS;
-  }
 
   UNLOCK_KERNEL()
 
   return result;
 }
 
-FUNC(tpl_status, OS_CODE) tpl_sem_post_service(CONST(SemType, AUTOMATIC) sem_id)
+FUNC(tpl_status, OS_CODE) tpl_sem_timed_wait_service(
+  CONST(SemType, AUTOMATIC)               sem_id,
+  CONST(tpl_tick, AUTOMATIC)              timeout,
+  CONST(SemWaitStatusRefType, AUTOMATIC)  status)
 {
+  VAR(tpl_status, AUTOMATIC) result = E_OK;
+#if WITH_SEM_TIMEDWAIT == YES
   GET_CURRENT_CORE_ID(core_id)
   GET_TPL_KERN_FOR_CORE_ID(core_id, kern)
   VAR(tpl_task_id, AUTOMATIC) task_id;
-  CONSTP2VAR(tpl_semaphore, AUTOMATIC, OS_CONST) sem = tpl_sem_table[sem_id];
+  P2VAR(tpl_semaphore, AUTOMATIC, OS_CONST) sem;
+  P2VAR(tpl_sem_waiter, AUTOMATIC, OS_VAR) waiter;
+  P2VAR(tpl_time_obj, AUTOMATIC, OS_APPL_DATA) time_obj;
+  P2VAR(tpl_counter, AUTOMATIC, OS_APPL_DATA) cnt;
+  VAR(tpl_tick, AUTOMATIC) date;
+#endif
 
   LOCK_KERNEL()
 
-  if (sem->size > 0)
+#if WITH_SEM_TIMEDWAIT == YES
+#if WITH_OS_EXTENDED == YES
+  if (sem_id >= SEMAPHORE_COUNT)
   {
-    task_id = tpl_sem_dequeue(sem);
-    /* release the task */
-    tpl_release(task_id);
-    if (TPL_KERN_REF(kern).need_schedule)
-    {
-      tpl_schedule_from_running(CORE_ID_OR_NOTHING(core_id));
-      SWITCH_CONTEXT(CORE_ID_OR_NOTHING(core_id))
-    }
+    result = E_OS_ID;
   }
-  else
+#endif
+
+  IF_NO_EXTENDED_ERROR(result)
   {
-    sem->token++;
+    sem = tpl_sem_table[sem_id];
+    task_id = TPL_KERN_REF(kern).running_id;
+    if ((sem->timeout == NULL) ||
+        (tpl_stat_proc_table[task_id]->max_activate_count != 1))
+    {
+      result = E_OS_ACCESS;
+    }
+    else if (timeout > sem->timeout->counter->max_allowed_value)
+    {
+      result = E_OS_VALUE;
+    }
+    else if (sem->token > 0)
+    {
+      sem->token--;
+      *status = SEM_ACQUIRED;
+    }
+    else if (timeout == 0)
+    {
+      /* nothing to wait for */
+      *status = SEM_TIMEOUT;
+    }
+    else
+    {
+      waiter = &tpl_sem_waiters[task_id];
+      waiter->sem = sem;
+      waiter->status = status;
+      waiter->task_id = task_id;
+
+      /* start the timeout the same way a relative alarm is started */
+      time_obj = &waiter->timeout;
+      time_obj->stat_part = sem->timeout;
+      TPL_UPDATE_COUNTERS(time_obj);
+      cnt = sem->timeout->counter;
+      date = cnt->current_date + timeout;
+      if (date > cnt->max_allowed_value)
+      {
+        date -= (cnt->max_allowed_value + 1);
+      }
+      time_obj->date = date;
+      time_obj->cycle = 0;
+      time_obj->state = TIME_OBJ_ACTIVE;
+      tpl_insert_time_obj(time_obj);
+      TPL_ENABLE_SHAREDSOURCE(time_obj);
+
+      tpl_sem_enqueue(sem, task_id);
+      /* block the running task */
+      tpl_block();
+    }
   }
+#else
+  /* no semaphore allows timed waits */
+  result = E_OS_ACCESS;
+#endif
 
   UNLOCK_KERNEL()
 
-  return E_OK;
+  return result;
 }
 
+FUNC(tpl_status, OS_CODE) tpl_sem_post_service(CONST(SemType, AUTOMATIC) sem_id)
+{
+  GET_CURRENT_CORE_ID(core_id)
+  GET_TPL_KERN_FOR_CORE_ID(core_id, kern)
+  VAR(tpl_status, AUTOMATIC) result = E_OK;
+  VAR(tpl_task_id, AUTOMATIC) task_id;
+  P2VAR(tpl_semaphore, AUTOMATIC, OS_CONST) sem;
+
+  LOCK_KERNEL()
+
+#if WITH_OS_EXTENDED == YES
+  if (sem_id >= SEMAPHORE_COUNT)
+  {
+    result = E_OS_ID;
+  }
+#endif
+
+  IF_NO_EXTENDED_ERROR(result)
+  {
+    sem = tpl_sem_table[sem_id];
+    if (sem->size > 0)
+    {
+      task_id = tpl_sem_dequeue(sem);
+#if WITH_SEM_TIMEDWAIT == YES
+      tpl_sem_stop_timeout(task_id);
+#endif
+      /* release the task */
+      tpl_release(task_id);
+      if (TPL_KERN_REF(kern).need_schedule && !DEFER_SCHEDULE())
+      {
+        tpl_schedule_from_running(CORE_ID_OR_NOTHING(core_id));
+        SWITCH_CONTEXT(CORE_ID_OR_NOTHING(core_id))
+      }
+    }
+    else
+    {
+      sem->token++;
+    }
+  }
 
+  UNLOCK_KERNEL()
 
+  return result;
+}
@@ -28,17 +28,71 @@
 
 #include "tpl_os_types.h"
 #include "tpl_os_semaphore.h"
+#include "tpl_os_timeobj_kernel.h"
 
+/**
+ * @typedef tpl_sem_queuing
+ *
+ * Order in which the waiting tasks of a semaphore get the posted tokens:
+ * - #SEM_FIFO_QUEUING: in the order they called SemWait
+ * - #SEM_PRIORITY_QUEUING: highest base priority first, FIFO among
+ *   the tasks of the same priority
+ */
+typedef uint8 tpl_sem_queuing;
+
+#define SEM_FIFO_QUEUING      0
+#define SEM_PRIORITY_QUEUING  1
+
+/*
+ * With FIFO queuing, waiting_tasks is a circular buffer and index is the
+ * slot where the next waiting task goes. With priority queuing,
+ * waiting_tasks[0..size-1] is sorted by increasing priority so that the
+ * task to release on SemPost is always the last one and index is unused.
+ *
+ * timeout is the static part of the time objects used by SemTimedWait.
+ * It is NULL if the semaphore does not allow timed waits.
+ */
 typedef struct {
-  uint32      token;
-  uint32      size;
-  uint32      index;
-  tpl_task_id waiting_tasks[TASK_COUNT];
+  uint32          token;
+  uint32          size;
+  uint32          index;
+  tpl_task_id     waiting_tasks[TASK_COUNT];
+  tpl_sem_queuing queuing;
+  P2VAR(tpl_time_obj_static, TYPEDEF, OS_APPL_DATA) timeout;
 } tpl_semaphore;
 
+#if WITH_SEM_TIMEDWAIT == YES
+/*
+ * A task waits for at most one semaphore at a time, so each task has one
+ * waiter. The time object has to be the first member: the expire function
+ * gets a pointer to it and casts it back to the waiter.
+ */
+typedef struct {
+  tpl_time_obj                                  timeout;
+  P2VAR(tpl_semaphore, TYPEDEF, OS_APPL_DATA)   sem;
+  SemWaitStatusRefType                          status;
+  tpl_task_id                                   task_id;
+} tpl_sem_waiter;
+#endif
+
 extern CONSTP2VAR(tpl_semaphore, AUTOMATIC, OS_APPL_DATA) tpl_sem_table[];
 
 FUNC(tpl_status, OS_CODE) tpl_sem_wait_service(CONST(SemType, AUTOMATIC) sem_id);
 FUNC(tpl_status, OS_CODE) tpl_sem_post_service(CONST(SemType, AUTOMATIC) sem_id);
+FUNC(tpl_status, OS_CODE) tpl_sem_timed_wait_service(
+  CONST(SemType, AUTOMATIC)               sem_id,
+  CONST(tpl_tick, AUTOMATIC)              timeout,
+  CONST(SemWaitStatusRefType, AUTOMATIC)  status);
+
+#if WITH_SEM_TIMEDWAIT == YES
+/**
+ * @internal
+ *
+ * Expire function of the SemTimedWait time objects. Called by
+ * tpl_counter_tick when the timeout of a waiting task expires.
+ */
+FUNC(void, OS_CODE) tpl_sem_timeout_expire(
+  P2VAR(tpl_time_obj, AUTOMATIC, OS_APPL_DATA) time_obj);
+#endif
 
 #endif
@@ -0,0 +1,82 @@
+/*
+ * @file tpl_os_service_stats.h
+ *
+ * @section desc File description
+ *
+ * Trampoline Service Statistics header file
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline RTOS
+ *
+ * Trampoline is copyright (c) CNRS, University of Nantes, Ecole Centrale de Nantes
+ * Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the GNU Public Licence V2.
+ * Check the LICENSE file in the root directory of Trampoline
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+#ifndef TPL_OS_SERVICE_STATS_H
+#define TPL_OS_SERVICE_STATS_H
+
+#include "tpl_os_types.h"
+#include "tpl_service_ids.h"
+
+/**
+ * @def SERVICE_STATS_BUCKET_COUNT
+ *
+ * Number of buckets of a service duration histogram. Bucket 0 counts the
+ * durations of 0 and 1 cycle, bucket i counts the durations in
+ * [2^i, 2^(i+1)[ cycles and the last bucket counts all the durations
+ * above 2^(SERVICE_STATS_BUCKET_COUNT-1) cycles.
+ */
+#define SERVICE_STATS_BUCKET_COUNT 16
+
+/**
+ * @typedef OSServiceIdType
+ *
+ * identifies a service, see the OSServiceId_xxx constants
+ */
+typedef uint8 OSServiceIdType;
+
+/**
+ * @struct TPL_SERVICE_STATS
+ *
+ * Durations of the calls to a service, in cycles of the target, from the
+ * entry in the service to its return or to the context switch it does.
+ */
+struct TPL_SERVICE_STATS
+{
+  VAR(uint32, TYPEDEF) count; /**< number of measured calls     */
+  VAR(uint32, TYPEDEF) min;   /**< shortest duration            */
+  VAR(uint32, TYPEDEF) max;   /**< longest duration             */
+  VAR(uint32, TYPEDEF)
+  histogram[SERVICE_STATS_BUCKET_COUNT]; /**< log2 histogram   */
+};
+
+/**
+ * @typedef ServiceStatsType
+ *
+ * This type is an alias for the #TPL_SERVICE_STATS structure.
+ *
+ * @see #TPL_SERVICE_STATS
+ */
+typedef struct TPL_SERVICE_STATS ServiceStatsType;
+
+/**
+ * @typedef ServiceStatsRefType
+ *
+ * References a #ServiceStatsType
+ */
+typedef P2VAR(ServiceStatsType, TYPEDEF, OS_APPL_DATA) ServiceStatsRefType;
+
+#endif /* TPL_OS_SERVICE_STATS_H */
+
+/* End of file tpl_os_service_stats.h */
@@ -0,0 +1,180 @@
+/**
+ * @file tpl_os_service_stats_kernel.c
+ *
+ * @section desc File description
+ *
+ * Trampoline Service Statistics implementation file
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline RTOS
+ *
+ * Trampoline is copyright (c) CNRS, University of Nantes, Ecole Centrale de
+ * Nantes Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the GNU Public Licence V2.
+ * Check the LICENSE file in the root directory of Trampoline
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+#include "tpl_machine_interface.h"
+#include "tpl_os_definitions.h"
+#include "tpl_os_error.h"
+#include "tpl_os_errorhook.h"
+#include "tpl_os_kernel.h"
+#include "tpl_os_service_stats_kernel.h"
+#include "tpl_trace.h"
+
+/*
+ * No service is being measured
+ */
+#define NO_SERVICE_MEASURED 0xFF
+
+#define OS_START_SEC_VAR_8BIT
+#include "tpl_memmap.h"
+
+STATIC VAR(OSServiceIdType, OS_VAR) measured_service = NO_SERVICE_MEASURED;
+
+#define OS_STOP_SEC_VAR_8BIT
+#include "tpl_memmap.h"
+
+#define OS_START_SEC_VAR_32BIT
+#include "tpl_memmap.h"
+
+STATIC VAR(uint32, OS_VAR) measure_start;
+
+#define OS_STOP_SEC_VAR_32BIT
+#include "tpl_memmap.h"
+
+#define OS_START_SEC_VAR_UNSPECIFIED
+#include "tpl_memmap.h"
+
+STATIC VAR(ServiceStatsType, OS_VAR) service_stats[SYSCALL_COUNT];
+
+#define OS_STOP_SEC_VAR_UNSPECIFIED
+#include "tpl_memmap.h"
+
+#define OS_START_SEC_CODE
+#include "tpl_memmap.h"
+
+/*
+ * tpl_service_stats_begin
+ */
+FUNC(tpl_bool, OS_CODE)
+tpl_service_stats_begin(CONST(OSServiceIdType, AUTOMATIC) service_id)
+{
+  VAR(tpl_bool, AUTOMATIC) measured = FALSE;
+
+  if (measured_service == NO_SERVICE_MEASURED)
+  {
+    measured_service = service_id;
+    measured = TRUE;
+    measure_start = tpl_get_cycle_count();
+  }
+
+  return measured;
+}
+
+/*
+ * tpl_service_stats_end
+ */
+FUNC(void, OS_CODE) tpl_service_stats_end(void)
+{
+  CONST(uint32, AUTOMATIC) duration = tpl_get_cycle_count() - measure_start;
+  CONST(OSServiceIdType, AUTOMATIC) service_id = measured_service;
+
+  if (service_id != NO_SERVICE_MEASURED)
+  {
+    P2VAR(ServiceStatsType, AUTOMATIC, OS_VAR) stats;
+    VAR(uint32, AUTOMATIC) bucket = 0;
+    VAR(uint32, AUTOMATIC) upper = duration >> 1;
+
+    /* free the measurement first, an interrupt may end it too */
+    measured_service = NO_SERVICE_MEASURED;
+
+    while ((upper != 0) && (bucket < (SERVICE_STATS_BUCKET_COUNT - 1)))
+    {
+      upper >>= 1;
+      bucket++;
+    }
+
+    stats = &service_stats[service_id];
+    if ((stats->count == 0) || (duration < stats->min))
+    {
+      stats->min = duration;
+    }
+    if (duration > stats->max)
+    {
+      stats->max = duration;
+    }
+    stats->count++;
+    stats->histogram[bucket]++;
+  }
+}
+
+/*
+ * tpl_get_service_stats_service
+ */
+FUNC(tpl_status, OS_CODE)
+tpl_get_service_stats_service(CONST(OSServiceIdType, AUTOMATIC) service_id,
+                              CONST(ServiceStatsRefType, AUTOMATIC) stats)
+{
+  GET_CURRENT_CORE_ID(core_id)
+
+  VAR(tpl_status, AUTOMATIC) result = E_OK;
+
+  LOCK_KERNEL()
+
+  /* check interrupts are not disabled by user    */
+  CHECK_INTERRUPT_LOCK(result)
+
+  STORE_SERVICE(OSServiceId_GetServiceStats)
+
+  /* check stats is in an authorized memory region */
+  CHECK_DATA_LOCATION(core_id, stats, result);
+
+#if WITH_OS_EXTENDED == YES
+  if ((result == E_OK) && (service_id >= SYSCALL_COUNT))
+  {
+    result = E_OS_ID;
+  }
+#endif
+
+  IF_NO_EXTENDED_ERROR(result)
+  {
+    *stats = service_stats[service_id];
+  }
+
+  PROCESS_ERROR(result)
+
+  UNLOCK_KERNEL()
+
+  return result;
+}
+
+/*
+ * tpl_service_stats_dump
+ */
+FUNC(void, OS_CODE) tpl_service_stats_dump(void)
+{
+  VAR(OSServiceIdType, AUTOMATIC) service_id;
+
+  for (service_id = 0; service_id < SYSCALL_COUNT; service_id++)
+  {
+    if (service_stats[service_id].count > 0)
+    {
+      TRACE_SERVICE_STATS(service_id, &service_stats[service_id])
+    }
+  }
+}
+
+#define OS_STOP_SEC_CODE
+#include "tpl_memmap.h"
+
+/* End of file tpl_os_service_stats_kernel.c */
@@ -0,0 +1,89 @@
+/**
+ * @file tpl_os_service_stats_kernel.h
+ *
+ * @section desc File description
+ *
+ * Trampoline Service Statistics kernel header file
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline RTOS
+ *
+ * Trampoline is copyright (c) CNRS, University of Nantes, Ecole Centrale de Nantes
+ * Trampoline is protected by the French intellectual property law.
+ *
+ * This software is distributed under the GNU Public Licence V2.
+ * Check the LICENSE file in the root directory of Trampoline
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+#ifndef TPL_OS_SERVICE_STATS_KERNEL_H
+#define TPL_OS_SERVICE_STATS_KERNEL_H
+
+#include "tpl_os_types.h"
+#include "tpl_os_service_stats.h"
+
+#define OS_START_SEC_CODE
+#include "tpl_memmap.h"
+
+/**
+ * @internal
+ *
+ * Starts the measurement of a call to a service. The generated service
+ * entry points (tpl_os.c or the dispatch table) call it before the
+ * kernel function of the service.
+ *
+ * Only one call is measured at a time: a service called while another one
+ * is measured, from a hook for instance, is not measured.
+ *
+ * @param service_id  identifier of the called service
+ *
+ * @retval TRUE   the call is measured, tpl_service_stats_end must follow
+ * @retval FALSE  the call is not measured
+ */
+FUNC(tpl_bool, OS_CODE) tpl_service_stats_begin(
+  CONST(OSServiceIdType, AUTOMATIC) service_id);
+
+/**
+ * @internal
+ *
+ * Ends the current measurement, if any, and records its duration. It is
+ * called when the kernel function of the service returns and, when the
+ * context switch is done by the service itself, just before the switch.
+ */
+FUNC(void, OS_CODE) tpl_service_stats_end(void);
+
+/**
+ * Get the statistics of a service
+ *
+ * @param service_id  identifier of the service
+ * @param stats       reference to the structure where the statistics are
+ *                    copied
+ *
+ * @retval  E_OK      no error
+ * @retval  E_OS_ID   (extended error only) service_id is invalid
+ */
+FUNC(tpl_status, OS_CODE) tpl_get_service_stats_service(
+  CONST(OSServiceIdType, AUTOMATIC)   service_id,
+  CONST(ServiceStatsRefType, AUTOMATIC) stats);
+
+/**
+ * @internal
+ *
+ * Dumps the statistics of the services that have been called in the
+ * trace. Called by ShutdownOS.
+ */
+FUNC(void, OS_CODE) tpl_service_stats_dump(void);
+
+#define OS_STOP_SEC_CODE
+#include "tpl_memmap.h"
+
+#endif /* TPL_OS_SERVICE_STATS_KERNEL_H */
+
+/* End of file tpl_os_service_stats_kernel.h */
@@ -87,7 +87,7 @@ tpl_activate_task_service(CONST(tpl_task_id, AUTOMATIC) task_id)
     DOW_DO(printf("*S* ActivateTask\n"));
 
     result = tpl_activate_task(task_id);
-    if (TPL_KERN(proc_core_id).need_schedule)
+    if (TPL_KERN(proc_core_id).need_schedule && !DEFER_SCHEDULE())
     {
       tpl_schedule_from_running(CORE_ID_OR_NOTHING(proc_core_id));
       DOW_DO(printf("*S* ActivateTask - rescheduling done\n"));
@@ -39,6 +39,10 @@ struct TPL_TASK_EVENTS
 {
   VAR(tpl_event_mask, TYPEDEF) evt_set;  /**< events received           */
   VAR(tpl_event_mask, TYPEDEF) evt_wait; /**< events the task waits for */
+  P2VAR(tpl_event_mask, TYPEDEF, OS_APPL_DATA)
+  evt_get_clear; /**< where the events that release a task blocked in
+                      WaitGetClearEvent are stored before being cleared,
+                      NULL if the task is blocked in WaitEvent          */
 };
 
 /**
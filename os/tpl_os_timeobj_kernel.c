@@ -333,6 +333,11 @@ tpl_counter_tick(P2VAR(tpl_counter, AUTOMATIC, OS_APPL_DATA) counter)
    */
   VAR(tpl_tick, AUTOMATIC) new_date;
 
+#if WITH_CPU_TIME == YES
+  /* keep the updates of the CPU time within the wrap around of the counter */
+  tpl_cpu_time_update();
+#endif /* WITH_CPU_TIME */
+
   if (tpl_counters_enabled)
   {
     /*  inc the current tick value of the counter     */
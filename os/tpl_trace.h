@@ -49,6 +49,7 @@ typedef uint8 tpl_trace_resource_state;
 #define TIMEOBJ_TYPE 4 // ALARM_SLEEP, ALARM_ACTIVE, ALARM EXPIRE
 #define MESSAGE_TYPE 5 // SEND_ZERO_MESSAGE, SEND or RECEIVE
 #define IOC_TYPE     6
+#define SCHEDULE_TYPE 7 // SCHEDULE_DEFERRED or SCHEDULE_COALESCED
 
 /* sub types */
 #define SEND_NONZERO_MESSAGE_KIND 0
@@ -61,6 +62,9 @@ typedef uint8 tpl_trace_resource_state;
 #define EVENT_SET_KIND            0
 #define EVENT_RESET_KIND          1
 
+#define SCHEDULE_DEFERRED_KIND    0
+#define SCHEDULE_COALESCED_KIND   1
+
 /* define the trace output types */
 #if WITH_TRACE == YES
      /**
@@ -84,6 +88,34 @@ typedef uint8 tpl_trace_resource_state;
        tpl_trace_proc_change_state(proc_id, target_state);
 #  else
 #    define TRACE_PROC_CHANGE_STATE(proc_id, target_state) 
+#  endif
+
+#  if (TRACE_PROC == YES) && (WITH_DEFERRED_SCHEDULE == YES)
+     /**
+     * Trace that an ISR2 skipped a reschedule (WITH_DEFERRED_SCHEDULE) and
+     * how many reschedules have been coalesced in the election done when
+     * the outermost ISR2 terminates.
+     * This function should be implemented in the machine dependant trace backend.
+     */
+#    define TRACE_SCHEDULE_DEFERRED(proc_id) \
+       tpl_trace_schedule_deferred(proc_id);
+#    define TRACE_SCHEDULE_COALESCED(count) \
+       tpl_trace_schedule_coalesced(count);
+#  else
+#    define TRACE_SCHEDULE_DEFERRED(proc_id)
+#    define TRACE_SCHEDULE_COALESCED(count)
+#  endif
+
+#  if TRACE_SERVICES == YES
+     /**
+     * Trace the statistics of a service (WITH_SERVICE_STATS), sent by
+     * ShutdownOS for each service that has been called.
+     * This function should be implemented in the machine dependant trace backend.
+     */
+#    define TRACE_SERVICE_STATS(service_id, stats) \
+       tpl_trace_service_stats(service_id, stats);
+#  else
+#    define TRACE_SERVICE_STATS(service_id, stats)
 #  endif
 
    /**
@@ -171,6 +203,9 @@ typedef uint8 tpl_trace_resource_state;
 #else /* no trace at all */
 #    define TRACE_CLOSE()
 #    define TRACE_PROC_CHANGE_STATE(proc_id, target_state) 
+#    define TRACE_SCHEDULE_DEFERRED(proc_id)
+#    define TRACE_SCHEDULE_COALESCED(count)
+#    define TRACE_SERVICE_STATS(service_id, stats)
 #    define TRACE_RES_CHANGE_STATE(res_id,target_state)
 #    define TRACE_TIMEOBJ_CHANGE_STATE(timeobj_id,target_state)
 #    define TRACE_TIMEOBJ_EXPIRE(timeobj_id)
@@ -203,6 +238,33 @@ FUNC(void, OS_CODE) tpl_trace_proc_change_state(
     CONST(tpl_proc_id,AUTOMATIC) proc_id,
     CONST(tpl_proc_state,AUTOMATIC) target_state);
 
+#if WITH_DEFERRED_SCHEDULE == YES
+/**
+* trace a reschedule skipped by a service called from an ISR2
+* @param proc_id    identifier of the running ISR2
+*/
+FUNC(void, OS_CODE) tpl_trace_schedule_deferred(
+    CONST(tpl_proc_id, AUTOMATIC) proc_id);
+
+/**
+* trace the election that ends a burst of ISR2
+* @param count      number of reschedules coalesced in this election
+*/
+FUNC(void, OS_CODE) tpl_trace_schedule_coalesced(
+    CONST(uint16, AUTOMATIC) count);
+#endif /* WITH_DEFERRED_SCHEDULE == YES */
+
+#if TRACE_SERVICES == YES
+/**
+* trace the statistics of a service
+* @param service_id identifier of the service
+* @param stats      statistics of the service
+*/
+FUNC(void, OS_CODE) tpl_trace_service_stats(
+    CONST(OSServiceIdType, AUTOMATIC) service_id,
+    P2CONST(ServiceStatsType, AUTOMATIC, OS_VAR) stats);
+#endif /* TRACE_SERVICES == YES */
+
 /**
 * trace the lock of a resource by an entity
 * @param res_id       identifier of the locked resource
@@ -0,0 +1,253 @@
+/**
+ * @file canif_s1/task1_instance.c
+ *
+ * @section desc File description
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline Test Suite
+ *
+ * Trampoline Test Suite is copyright (c) IRCCyN 2005-2007
+ * Trampoline Test Suite is protected by the French intellectual property law.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2
+ * of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+/*Instance of task t1*/
+
+#include "tpl_os.h"
+#include <Can.h>
+#include <CanIf.h>
+#include <string.h>
+
+/* fake controller, the received frames are read from rx_frames */
+#define RX_FRAMES_MAX 8
+
+static Can_PduType rx_frames[RX_FRAMES_MAX];
+static uint8 rx_payloads[RX_FRAMES_MAX][8];
+static unsigned int rx_head, rx_tail;
+
+static int fake_init(struct tpl_can_controller_config_t *config)
+{
+	(void)config;
+	return 0;
+}
+
+static int fake_set_baudrate(struct tpl_can_controller_t *ctrl, CanControllerBaudrateConfig *baud_rate_config)
+{
+	(void)ctrl;
+	(void)baud_rate_config;
+	return 0;
+}
+
+static Std_ReturnType fake_transmit(struct tpl_can_controller_t *ctrl, const Can_PduType *pdu_info)
+{
+	(void)ctrl;
+	(void)pdu_info;
+	return E_OK;
+}
+
+static Std_ReturnType fake_receive(struct tpl_can_controller_t *ctrl, Can_PduType *pdu_info)
+{
+	(void)ctrl;
+	pdu_info->id = rx_frames[rx_head].id;
+	pdu_info->length = rx_frames[rx_head].length;
+	memcpy(pdu_info->sdu, rx_frames[rx_head].sdu, rx_frames[rx_head].length);
+	rx_head++;
+	return E_OK;
+}
+
+static int fake_is_data_available(struct tpl_can_controller_t *ctrl)
+{
+	(void)ctrl;
+	return rx_head < rx_tail;
+}
+
+static tpl_can_controller_t fake_controller =
+{
+	0,
+	fake_init,
+	fake_set_baudrate,
+	fake_transmit,
+	fake_receive,
+	fake_is_data_available,
+	NULL
+};
+
+static tpl_can_controller_config_t controller_configs[] =
+{
+	{ &fake_controller, { 0 } }
+};
+
+static const Can_ConfigType can_config =
+{
+	controller_configs,
+	1
+};
+
+static void push_frame(Can_IdType id, uint8 first_byte)
+{
+	rx_frames[rx_tail].id = id;
+	rx_frames[rx_tail].length = 2;
+	rx_frames[rx_tail].sdu = rx_payloads[rx_tail];
+	rx_payloads[rx_tail][0] = first_byte;
+	rx_payloads[rx_tail][1] = 0x5A;
+	rx_tail++;
+}
+
+/* upper layer PDU buffers */
+static uint8 payload_a[8], payload_b[8], payload_m[8];
+static Can_PduType buffer_a = { 0, 0, 0, payload_a };
+static Can_PduType buffer_b = { 0, 0, 0, payload_b };
+static Can_PduType buffer_m = { 0, 0, 0, payload_m };
+
+static unsigned int indication_count;
+static PduIdType last_indication;
+
+static void rx_indication(PduIdType pdu_id, const Can_PduType *pdu)
+{
+	(void)pdu;
+	indication_count++;
+	last_indication = pdu_id;
+}
+
+static const CanIf_RxPduConfigType rx_pdus[] =
+{
+	{ 0x123 | TPL_CAN_ID_TYPE_STANDARD, TPL_CANIF_EXACT_MASK, 10, &buffer_a, rx_indication },
+	{ 0x1ABCD0 | TPL_CAN_ID_TYPE_EXTENDED, TPL_CANIF_EXACT_MASK, 11, &buffer_b, NULL },
+	/* 0x300 to 0x30F */
+	{ 0x300 | TPL_CAN_ID_TYPE_STANDARD, TPL_CAN_ID_TYPE_EXTENDED | 0x7F0, 12, &buffer_m, rx_indication }
+};
+
+/* accept only the IDs whose bit 0x004 is clear */
+static const CanIf_AcceptanceFilterType filters[] =
+{
+	{ 0x000, 0x004 }
+};
+
+static const CanIf_ConfigType canif_config =
+{
+	rx_pdus,
+	3,
+	filters,
+	1
+};
+
+static const CanIf_RxPduConfigType bad_rx_pdus[] =
+{
+	{ 0x123 | TPL_CAN_ID_TYPE_STANDARD, TPL_CANIF_EXACT_MASK, 10, NULL, NULL }
+};
+
+static const CanIf_ConfigType bad_canif_config =
+{
+	bad_rx_pdus,
+	1,
+	NULL,
+	0
+};
+
+/*test case:test the routing of the received frames to the PDU buffers*/
+static void test_t1_instance(void)
+{
+	int result_inst_1;
+	Std_ReturnType result_inst_2, result_inst_8;
+	unsigned int result_inst_3, result_inst_4, result_inst_5, result_inst_6, result_inst_7;
+	
+	SCHEDULING_CHECK_INIT(1);
+	result_inst_1 = Can_Init(&can_config);
+	SCHEDULING_CHECK_AND_EQUAL_INT(1,0, result_inst_1);
+	
+	SCHEDULING_CHECK_INIT(2);
+	result_inst_2 = CanIf_SetRxRouting(&canif_config);
+	SCHEDULING_CHECK_AND_EQUAL_INT(2,E_OK, result_inst_2);
+	
+	/* single CAN ID routes, the CAN-FD flag is not compared */
+	SCHEDULING_CHECK_INIT(3);
+	push_frame(0x123 | TPL_CAN_ID_TYPE_STANDARD, 0x11);
+	push_frame(0x1ABCD0 | TPL_CAN_ID_TYPE_FD_EXTENDED, 0x22);
+	result_inst_3 = CanIf_DispatchRx(0);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(3,2, result_inst_3);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(3,0x123 | TPL_CAN_ID_TYPE_STANDARD, buffer_a.id);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(3,10, buffer_a.swPduHandle);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(3,2, buffer_a.length);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(3,0x11, payload_a[0]);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(3,0x5A, payload_a[1]);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(3,0x1ABCD0 | TPL_CAN_ID_TYPE_FD_EXTENDED, buffer_b.id);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(3,11, buffer_b.swPduHandle);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(3,0x22, payload_b[0]);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(3,1, indication_count);
+	SCHEDULING_CHECK_AND_EQUAL_INT(3,10, last_indication);
+	
+	/* a standard ID does not match the route of the same extended ID */
+	SCHEDULING_CHECK_INIT(4);
+	push_frame(0x123 | TPL_CAN_ID_TYPE_EXTENDED, 0x33);
+	result_inst_4 = CanIf_DispatchRx(0);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(4,0, result_inst_4);
+	SCHEDULING_CHECK_AND_EQUAL_INT(4,0x11, payload_a[0]);
+	
+	/* masked route */
+	SCHEDULING_CHECK_INIT(5);
+	push_frame(0x30A | TPL_CAN_ID_TYPE_FD_STANDARD, 0x44);
+	push_frame(0x320 | TPL_CAN_ID_TYPE_STANDARD, 0x55);
+	result_inst_5 = CanIf_DispatchRx(0);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(5,1, result_inst_5);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(5,0x30A | TPL_CAN_ID_TYPE_FD_STANDARD, buffer_m.id);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(5,12, buffer_m.swPduHandle);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(5,0x44, payload_m[0]);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(5,2, indication_count);
+	SCHEDULING_CHECK_AND_EQUAL_INT(5,12, last_indication);
+	
+	/* acceptance filter, 0x304 would match the masked route without it */
+	SCHEDULING_CHECK_INIT(6);
+	push_frame(0x304 | TPL_CAN_ID_TYPE_STANDARD, 0x66);
+	push_frame(0x123 | TPL_CAN_ID_TYPE_STANDARD, 0x77);
+	result_inst_6 = CanIf_DispatchRx(0);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(6,1, result_inst_6);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(6,0x44, payload_m[0]);
+	SCHEDULING_CHECK_AND_EQUAL_INT(6,0x77, payload_a[0]);
+	
+	/* no dispatch on an unknown controller */
+	SCHEDULING_CHECK_INIT(7);
+	push_frame(0x123 | TPL_CAN_ID_TYPE_STANDARD, 0x88);
+	result_inst_7 = CanIf_DispatchRx(1);
+	SCHEDULING_CHECK_AND_EQUAL_INT(7,0, result_inst_7);
+	
+	/* a route without buffer is rejected, the routing is then disabled */
+	SCHEDULING_CHECK_INIT(8);
+	result_inst_8 = CanIf_SetRxRouting(&bad_canif_config);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(8,E_NOT_OK, result_inst_8);
+	result_inst_7 = CanIf_DispatchRx(0);
+	SCHEDULING_CHECK_AND_EQUAL_INT(8,0, result_inst_7);
+}
+
+/*create the test suite with all the test cases*/
+TestRef CanIfTest_seq1_t1_instance(void)
+{
+	EMB_UNIT_TESTFIXTURES(fixtures) {
+		new_TestFixture("test_t1_instance",test_t1_instance)
+	};
+	EMB_UNIT_TESTCALLER(CanIfTest,"CanIfTest_sequence1",NULL,NULL,fixtures);
+	
+	return (TestRef)&CanIfTest;
+}
+
+/* End of file canif_s1/task1_instance.c */
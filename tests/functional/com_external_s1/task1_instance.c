@@ -0,0 +1,161 @@
+/**
+ * @file com_external_s1/task1_instance.c
+ *
+ * @section desc File description
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline Test Suite
+ *
+ * Trampoline Test Suite is copyright (c) IRCCyN 2005-2007
+ * Trampoline Test Suite is protected by the French intellectual property law.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2
+ * of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+/*Instance of task t1*/
+
+#include "tpl_os.h"
+#include "tpl_app_config.h"
+#include "tpl_com_ipdu.h"
+#include "tpl_com_definitions.h"  /*for E_COM_ID and E_COM_LENGTH*/
+
+/*test case:test the generated pack and unpack functions of the IPDUs and the external messages*/
+static void test_t1_instance(void)
+{
+	StatusType result_inst_3, result_inst_4, result_inst_5, result_inst_6, result_inst_7, result_inst_8, result_inst_9, result_inst_10, result_inst_11, result_inst_12, result_inst_13;
+	uint16 range_value_1 = 0;
+	uint16 range_value_2 = 0;
+	uint16 range_value_3 = 0;
+	uint16 message_value = 0x456;
+	uint16 received_value = 0;
+	uint8 received_byte = 0;
+	CONST(uint8, AUTOMATIC) frame[5] = { 0xFD, 0x11, 0x22, 0x78, 0x56 };
+	CONST(uint8, AUTOMATIC) frame_in_range[5] = { 0xFE, 0x11, 0x22, 0x78, 0x56 };
+	
+	SCHEDULING_CHECK_INIT(1);
+	nm_tx_a_net_value = 0xABC;
+	nm_tx_b_net_value = 0x1234;
+	tpl_pack_ipdu_tx_ipdu();
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(1,0xC0, ipdu_tx_ipdu_buffer[0]);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(1,0xAB, ipdu_tx_ipdu_buffer[1]);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(1,0x12, ipdu_tx_ipdu_buffer[2]);
+	SCHEDULING_CHECK_AND_EQUAL_INT(1,0x34, ipdu_tx_ipdu_buffer[3]);
+	
+	SCHEDULING_CHECK_INIT(2);
+	ipdu_tx_ipdu_buffer[0] = 0x0F;
+	nm_tx_a_net_value = 0x123;
+	tpl_pack_ipdu_tx_ipdu();
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(2,0x3F, ipdu_tx_ipdu_buffer[0]);
+	SCHEDULING_CHECK_AND_EQUAL_INT(2,0x12, ipdu_tx_ipdu_buffer[1]);
+	
+	SCHEDULING_CHECK_INIT(3);
+	result_inst_3 = tpl_receive_ipdu(ipdu_rx_ipdu_id, frame, 5);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(3,E_OK, result_inst_3);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(3,5, nm_rx_a_net_value);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(3,0x11, nm_rx_b_net_value[0]);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(3,0x22, nm_rx_b_net_value[1]);
+	SCHEDULING_CHECK_AND_EQUAL_INT(3,0x5678, nm_rx_c_net_value);
+	
+	SCHEDULING_CHECK_INIT(4);
+	result_inst_4 = tpl_receive_ipdu(ipdu_rx_ipdu_id, frame, 4);
+	SCHEDULING_CHECK_AND_EQUAL_INT(4,E_COM_LENGTH, result_inst_4);
+	
+	SCHEDULING_CHECK_INIT(5);
+	result_inst_5 = tpl_receive_ipdu(RECEIVE_IPDU_COUNT, frame, 5);
+	SCHEDULING_CHECK_AND_EQUAL_INT(5,E_COM_ID, result_inst_5);
+	
+	SCHEDULING_CHECK_INIT(6);
+	result_inst_6 = SendMessage(msg_tx_a, &message_value);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(6,E_OK, result_inst_6);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(6,0x456, nm_tx_a_net_value);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(6,0x6F, ipdu_tx_ipdu_buffer[0]);
+	SCHEDULING_CHECK_AND_EQUAL_INT(6,0x45, ipdu_tx_ipdu_buffer[1]);
+	
+	SCHEDULING_CHECK_INIT(7);
+	message_value = 0xBEEF;
+	result_inst_7 = SendMessage(msg_tx_b, &message_value);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(7,E_OK, result_inst_7);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(7,0xBE, ipdu_tx_ipdu_buffer[2]);
+	SCHEDULING_CHECK_AND_EQUAL_INT(7,0xEF, ipdu_tx_ipdu_buffer[3]);
+	
+	SCHEDULING_CHECK_INIT(8);
+	result_inst_8 = ReceiveMessage(msg_tx_b_internal, &received_value);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(8,E_OK, result_inst_8);
+	SCHEDULING_CHECK_AND_EQUAL_INT(8,0xBEEF, received_value);
+	
+	SCHEDULING_CHECK_INIT(9);
+	result_inst_9 = ReceiveMessage(msg_rx_a, &received_byte);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(9,E_OK, result_inst_9);
+	SCHEDULING_CHECK_AND_EQUAL_INT(9,5, received_byte);
+	
+	SCHEDULING_CHECK_INIT(10);
+	result_inst_10 = ReceiveMessage(msg_rx_c, &received_value);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(10,E_OK, result_inst_10);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(10,0x5678, received_value);
+	result_inst_10 = ReceiveMessage(msg_rx_c, &received_value);
+	SCHEDULING_CHECK_AND_EQUAL_INT(10,E_COM_NOMSG, result_inst_10);
+	
+	SCHEDULING_CHECK_INIT(11);
+	message_value = 0x150;
+	result_inst_11 = SendMessage(msg_tx_b, &message_value);
+	ReceiveMessage(msg_tx_b_range_1, &range_value_1);
+	ReceiveMessage(msg_tx_b_range_2, &range_value_2);
+	ReceiveMessage(msg_tx_b_range_3, &range_value_3);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(11,E_OK, result_inst_11);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(11,0x150, range_value_1);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(11,0xBEEF, range_value_2);
+	SCHEDULING_CHECK_AND_EQUAL_INT(11,0x150, range_value_3);
+	
+	SCHEDULING_CHECK_INIT(12);
+	message_value = 0x300;
+	result_inst_12 = SendMessage(msg_tx_b, &message_value);
+	ReceiveMessage(msg_tx_b_range_1, &range_value_1);
+	ReceiveMessage(msg_tx_b_range_2, &range_value_2);
+	ReceiveMessage(msg_tx_b_range_3, &range_value_3);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(12,E_OK, result_inst_12);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(12,0x150, range_value_1);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(12,0x300, range_value_2);
+	SCHEDULING_CHECK_AND_EQUAL_INT(12,0x150, range_value_3);
+	
+	SCHEDULING_CHECK_INIT(13);
+	received_byte = 0xFF;
+	ReceiveMessage(msg_rx_a_range, &received_byte);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(13,0, received_byte);
+	result_inst_13 = tpl_receive_ipdu(ipdu_rx_ipdu_id, frame_in_range, 5);
+	ReceiveMessage(msg_rx_a_range, &received_byte);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(13,E_OK, result_inst_13);
+	SCHEDULING_CHECK_AND_EQUAL_INT(13,6, received_byte);
+}
+
+/*create the test suite with all the test cases*/
+TestRef COMExternalTest_seq1_t1_instance(void)
+{
+	EMB_UNIT_TESTFIXTURES(fixtures) {
+		new_TestFixture("test_t1_instance",test_t1_instance)
+	};
+	EMB_UNIT_TESTCALLER(COMExternalTest,"COMExternalTest_sequence1",NULL,NULL,fixtures);
+	
+	return (TestRef)&COMExternalTest;
+}
+
+/* End of file com_external_s1/task1_instance.c */
@@ -0,0 +1,95 @@
+/**
+ * @file cputime_s1/task1_instance.c
+ *
+ * @section desc File description
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline Test Suite
+ *
+ * Trampoline Test Suite is copyright (c) IRCCyN 2005-2007
+ * Trampoline Test Suite is protected by the French intellectual property law.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2
+ * of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+/*Instance of task t1*/
+
+#include "tpl_os.h"
+
+DeclareTask(t1);
+DeclareTask(t2);
+DeclareTask(INVALID_TASK);
+DeclareAlarm(Alarm1);
+
+/*test case:test the CPU time of t1 and of t2 that preempts it*/
+static void test_t1_instance(void)
+{
+	StatusType result_inst_1, result_inst_2, result_inst_3, result_inst_4, result_inst_5, result_inst_6;
+	CpuTimeType cpu_time;
+	uint8 load;
+	
+	SCHEDULING_CHECK_INIT(1);
+	result_inst_1 = GetTaskCpuTime(t1, &cpu_time);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(1,E_OK, result_inst_1);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(1,1, cpu_time.execution_time > 0);
+	SCHEDULING_CHECK_AND_EQUAL_INT(1,0, cpu_time.preemption_count);
+	
+	SCHEDULING_CHECK_INIT(2);
+	result_inst_2 = ActivateTask(t2);
+	SCHEDULING_CHECK_AND_EQUAL_INT(3,E_OK, result_inst_2);
+	
+	SCHEDULING_CHECK_INIT(4);
+	result_inst_3 = GetTaskCpuTime(t2, &cpu_time);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(4,E_OK, result_inst_3);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(4,1, cpu_time.execution_time > 0);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(4,1, cpu_time.response_time > 0);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(4,1, cpu_time.execution_time <= cpu_time.response_time);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(4,cpu_time.response_time, cpu_time.max_response_time);
+	SCHEDULING_CHECK_AND_EQUAL_INT(4,0, cpu_time.preemption_count);
+	
+	SCHEDULING_CHECK_INIT(5);
+	result_inst_4 = GetCpuLoad(&load);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(5,E_OK, result_inst_4);
+	SCHEDULING_CHECK_AND_EQUAL_INT(5,100, load);
+	
+	SCHEDULING_CHECK_INIT(6);
+	result_inst_5 = GetTaskCpuTime(INVALID_TASK, &cpu_time);
+	SCHEDULING_CHECK_AND_EQUAL_INT(6,E_OS_ID, result_inst_5);
+	
+	SCHEDULING_CHECK_INIT(7);
+	result_inst_6 = SetRelAlarm(Alarm1, 100, 0);
+	SCHEDULING_CHECK_AND_EQUAL_INT(7,E_OK, result_inst_6);
+}
+
+/*create the test suite with all the test cases*/
+TestRef CpuTimeTest_seq1_t1_instance(void)
+{
+	EMB_UNIT_TESTFIXTURES(fixtures) {
+		new_TestFixture("test_t1_instance",test_t1_instance)
+	};
+	EMB_UNIT_TESTCALLER(CpuTimeTest,"CpuTimeTest_sequence1",NULL,NULL,fixtures);
+	
+	return (TestRef)&CpuTimeTest;
+}
+
+/* End of file cputime_s1/task1_instance.c */
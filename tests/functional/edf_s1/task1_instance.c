@@ -0,0 +1,103 @@
+/**
+ * @file edf_s1/task1_instance.c
+ *
+ * @section desc File description
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline Test Suite
+ *
+ * Trampoline Test Suite is copyright (c) IRCCyN 2005-2007
+ * Trampoline Test Suite is protected by the French intellectual property law.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2
+ * of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+/*Instance of task t1*/
+
+#include "tpl_os.h"
+
+DeclareTask(t2);
+DeclareTask(t3);
+DeclareTask(t4);
+DeclareResource(Resource1);
+DeclareCounter(EdfCounter);
+
+/*test case:test the order of the tasks of the same priority*/
+static void test_t1_instance(void)
+{
+	StatusType result_inst_1, result_inst_2, result_inst_3, result_inst_4, result_inst_5, result_inst_6, result_inst_7, result_inst_8;
+	int i;
+	
+	/* deadline 10 is earlier than 40, t2 preempts t1 */
+	SCHEDULING_CHECK_INIT(1);
+	result_inst_1 = ActivateTask(t2);
+	SCHEDULING_CHECK_AND_EQUAL_INT(2,E_OK, result_inst_1);
+	
+	/* t4 has no deadline */
+	SCHEDULING_CHECK_INIT(3);
+	result_inst_2 = ActivateTask(t4);
+	SCHEDULING_CHECK_AND_EQUAL_INT(3,E_OK, result_inst_2);
+	
+	/* deadline 45 is later than 40 */
+	SCHEDULING_CHECK_INIT(4);
+	result_inst_3 = ActivateTask(t3);
+	SCHEDULING_CHECK_AND_EQUAL_INT(4,E_OK, result_inst_3);
+	
+	/* the ceiling of Resource1 is above t2 */
+	SCHEDULING_CHECK_INIT(5);
+	result_inst_4 = GetResource(Resource1);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(5,E_OK, result_inst_4);
+	result_inst_5 = ActivateTask(t2);
+	SCHEDULING_CHECK_AND_EQUAL_INT(5,E_OK, result_inst_5);
+	
+	SCHEDULING_CHECK_INIT(6);
+	result_inst_6 = ReleaseResource(Resource1);
+	SCHEDULING_CHECK_AND_EQUAL_INT(7,E_OK, result_inst_6);
+	
+	/* date 45, the deadline 40 of t1 is missed and stays the earliest */
+	SCHEDULING_CHECK_INIT(8);
+	result_inst_7 = E_OK;
+	for (i = 0; i < 45; i++)
+	{
+		if (IncrementCounter(EdfCounter) != E_OK)
+		{
+			result_inst_7 = E_OS_STATE;
+		}
+	}
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(8,E_OK, result_inst_7);
+	result_inst_8 = ActivateTask(t2);
+	SCHEDULING_CHECK_AND_EQUAL_INT(8,E_OK, result_inst_8);
+}
+
+/*create the test suite with all the test cases*/
+TestRef EdfTest_seq1_t1_instance(void)
+{
+	EMB_UNIT_TESTFIXTURES(fixtures) {
+		new_TestFixture("test_t1_instance",test_t1_instance)
+	};
+	EMB_UNIT_TESTCALLER(EdfTest,"EdfTest_sequence1",NULL,NULL,fixtures);
+	
+	return (TestRef)&EdfTest;
+}
+
+/* End of file edf_s1/task1_instance.c */
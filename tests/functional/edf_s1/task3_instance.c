@@ -0,0 +1,77 @@
+/**
+ * @file edf_s1/task3_instance.c
+ *
+ * @section desc File description
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline Test Suite
+ *
+ * Trampoline Test Suite is copyright (c) IRCCyN 2005-2007
+ * Trampoline Test Suite is protected by the French intellectual property law.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2
+ * of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+/*Instance of task t3*/
+
+#include "tpl_os.h"
+
+DeclareTask(t5);
+DeclareTask(t6);
+DeclareCounter(EdfCounter);
+
+/*test case:test the deadlines across the wrap around of the counter*/
+static void test_t3_instance(void)
+{
+	StatusType result_inst_1, result_inst_2, result_inst_3;
+	int i;
+	
+	/* date 93, t5 gets the deadline 23 after the wrap around, t6 gets 96 */
+	SCHEDULING_CHECK_INIT(9);
+	result_inst_1 = E_OK;
+	for (i = 0; i < 48; i++)
+	{
+		if (IncrementCounter(EdfCounter) != E_OK)
+		{
+			result_inst_1 = E_OS_STATE;
+		}
+	}
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(9,E_OK, result_inst_1);
+	result_inst_2 = ActivateTask(t5);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(9,E_OK, result_inst_2);
+	result_inst_3 = ActivateTask(t6);
+	SCHEDULING_CHECK_AND_EQUAL_INT(9,E_OK, result_inst_3);
+}
+
+/*create the test suite with all the test cases*/
+TestRef EdfTest_seq1_t3_instance(void)
+{
+	EMB_UNIT_TESTFIXTURES(fixtures) {
+		new_TestFixture("test_t3_instance",test_t3_instance)
+	};
+	EMB_UNIT_TESTCALLER(EdfTest,"EdfTest_sequence1",NULL,NULL,fixtures);
+	
+	return (TestRef)&EdfTest;
+}
+
+/* End of file edf_s1/task3_instance.c */
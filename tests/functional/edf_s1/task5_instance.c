@@ -0,0 +1,64 @@
+/**
+ * @file edf_s1/task5_instance.c
+ *
+ * @section desc File description
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline Test Suite
+ *
+ * Trampoline Test Suite is copyright (c) IRCCyN 2005-2007
+ * Trampoline Test Suite is protected by the French intellectual property law.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2
+ * of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+/*Instance of task t5*/
+
+#include "tpl_os.h"
+
+DeclareTask(t5);
+
+/*test case:t5 runs after t6 whose deadline is before the wrap around*/
+static void test_t5_instance(void)
+{
+	StatusType result_inst_1;
+	TaskType task_id;
+	
+	SCHEDULING_CHECK_INIT(12);
+	result_inst_1 = GetTaskID(&task_id);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(12,E_OK, result_inst_1);
+	SCHEDULING_CHECK_AND_EQUAL_INT(12,t5, task_id);
+}
+
+/*create the test suite with all the test cases*/
+TestRef EdfTest_seq1_t5_instance(void)
+{
+	EMB_UNIT_TESTFIXTURES(fixtures) {
+		new_TestFixture("test_t5_instance",test_t5_instance)
+	};
+	EMB_UNIT_TESTCALLER(EdfTest,"EdfTest_sequence1",NULL,NULL,fixtures);
+	
+	return (TestRef)&EdfTest;
+}
+
+/* End of file edf_s1/task5_instance.c */
@@ -0,0 +1,115 @@
+/**
+ * @file mempool_s1/task1_instance.c
+ *
+ * @section desc File description
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline Test Suite
+ *
+ * Trampoline Test Suite is copyright (c) IRCCyN 2005-2007
+ * Trampoline Test Suite is protected by the French intellectual property law.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2
+ * of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+/*Instance of task t1*/
+
+#include "tpl_os.h"
+
+DeclareTask(t2);
+DeclareMemPool(pool1);
+DeclareMemPool(pool2);
+
+/* block handed to t2 */
+BlockRefType shared_block;
+
+/*test case:test the allocation and the release of the blocks of a pool*/
+static void test_t1_instance(void)
+{
+	StatusType result_inst_1, result_inst_2, result_inst_3, result_inst_4, result_inst_5, result_inst_6, result_inst_7, result_inst_8, result_inst_9, result_inst_10;
+	BlockRefType b1, b2, b3, b4, c1;
+	uint8 i;
+	
+	SCHEDULING_CHECK_INIT(1);
+	result_inst_1 = GetBlock(pool1, &b1);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(1,E_OK, result_inst_1);
+	SCHEDULING_CHECK_AND_EQUAL_INT(1,1, b1 != NULL);
+	
+	SCHEDULING_CHECK_INIT(2);
+	result_inst_2 = GetBlock(pool1, &b2);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(2,E_OK, result_inst_2);
+	SCHEDULING_CHECK_AND_EQUAL_INT(2,1, (b2 != NULL) && (b2 != b1));
+	
+	SCHEDULING_CHECK_INIT(3);
+	result_inst_3 = GetBlock(pool1, &b3);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(3,E_OK, result_inst_3);
+	SCHEDULING_CHECK_AND_EQUAL_INT(3,1, (b3 != b1) && (b3 != b2));
+	
+	SCHEDULING_CHECK_INIT(4);
+	result_inst_4 = GetBlock(pool1, &b4);
+	SCHEDULING_CHECK_AND_EQUAL_INT(4,E_OS_LIMIT, result_inst_4);
+	
+	SCHEDULING_CHECK_INIT(5);
+	result_inst_5 = GetBlock(pool2, &c1);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(5,E_OK, result_inst_5);
+	SCHEDULING_CHECK_AND_EQUAL_INT(5,1, (c1 != b1) && (c1 != b2) && (c1 != b3));
+	
+	for (i = 0; i < 10; i++)
+	{
+		((uint8 *)b2)[i] = i;
+	}
+	shared_block = b2;
+	SCHEDULING_CHECK_INIT(6);
+	result_inst_6 = ActivateTask(t2);
+	SCHEDULING_CHECK_AND_EQUAL_INT(7,E_OK, result_inst_6);
+	
+	SCHEDULING_CHECK_INIT(8);
+	result_inst_7 = GetBlock(pool1, &b4);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(8,E_OK, result_inst_7);
+	SCHEDULING_CHECK_AND_EQUAL_INT(8,1, b4 == b2);
+	
+	SCHEDULING_CHECK_INIT(9);
+	result_inst_8 = ReleaseBlock(pool1, (BlockRefType)((uint8 *)b1 + 1));
+	SCHEDULING_CHECK_AND_EQUAL_INT(9,E_OS_VALUE, result_inst_8);
+	
+	SCHEDULING_CHECK_INIT(10);
+	result_inst_9 = ReleaseBlock(pool1, c1);
+	SCHEDULING_CHECK_AND_EQUAL_INT(10,E_OS_VALUE, result_inst_9);
+	
+	SCHEDULING_CHECK_INIT(11);
+	result_inst_10 = GetBlock(MEMPOOL_COUNT, &b4);
+	SCHEDULING_CHECK_AND_EQUAL_INT(11,E_OS_ID, result_inst_10);
+}
+
+/*create the test suite with all the test cases*/
+TestRef MemPoolTest_seq1_t1_instance(void)
+{
+	EMB_UNIT_TESTFIXTURES(fixtures) {
+		new_TestFixture("test_t1_instance",test_t1_instance)
+	};
+	EMB_UNIT_TESTCALLER(MemPoolTest,"MemPoolTest_sequence1",NULL,NULL,fixtures);
+	
+	return (TestRef)&MemPoolTest;
+}
+
+/* End of file mempool_s1/task1_instance.c */
@@ -0,0 +1,75 @@
+/**
+ * @file mempool_s1/task2_instance.c
+ *
+ * @section desc File description
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline Test Suite
+ *
+ * Trampoline Test Suite is copyright (c) IRCCyN 2005-2007
+ * Trampoline Test Suite is protected by the French intellectual property law.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2
+ * of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+/*Instance of task t2*/
+
+#include "tpl_os.h"
+
+DeclareMemPool(pool1);
+
+extern BlockRefType shared_block;
+
+/*test case:test a block got by t1 is released by t2*/
+static void test_t2_instance(void)
+{
+	StatusType result_inst_1;
+	uint8 i;
+	uint8 intact = 1;
+	
+	for (i = 0; i < 10; i++)
+	{
+		if (((uint8 *)shared_block)[i] != i)
+		{
+			intact = 0;
+		}
+	}
+	
+	SCHEDULING_CHECK_INIT(7);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(7,1, intact);
+	result_inst_1 = ReleaseBlock(pool1, shared_block);
+	SCHEDULING_CHECK_AND_EQUAL_INT(7,E_OK, result_inst_1);
+}
+
+/*create the test suite with all the test cases*/
+TestRef MemPoolTest_seq1_t2_instance(void)
+{
+	EMB_UNIT_TESTFIXTURES(fixtures) {
+		new_TestFixture("test_t2_instance",test_t2_instance)
+	};
+	EMB_UNIT_TESTCALLER(MemPoolTest,"MemPoolTest_sequence1",NULL,NULL,fixtures);
+	
+	return (TestRef)&MemPoolTest;
+}
+
+/* End of file mempool_s1/task2_instance.c */
@@ -0,0 +1,61 @@
+/**
+ * @file resources_s6/task1_instance.c
+ *
+ * @section desc File description
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline Test Suite
+ *
+ * Trampoline Test Suite is copyright (c) IRCCyN 2005-2007
+ * Trampoline Test Suite is protected by the French intellectual property law.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2
+ * of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+/*Instance of task t3*/
+
+#include "tpl_os.h"
+
+/*test case:test the task of higher priority preempts the holder of the resource*/
+static void test_t3_instance(void)
+{
+	StatusType result_inst_1;
+	
+	SCHEDULING_CHECK_INIT(5);
+	result_inst_1 = TerminateTask();
+	SCHEDULING_CHECK_AND_EQUAL_INT(5,E_OK, result_inst_1);
+	
+}
+
+/*create the test suite with all the test cases*/
+TestRef ResourceManagementTest_seq6_t3_instance(void)
+{
+	EMB_UNIT_TESTFIXTURES(fixtures) {
+		new_TestFixture("test_t3_instance",test_t3_instance)
+	};
+	EMB_UNIT_TESTCALLER(ResourceManagementTest,"ResourceManagementTest_sequence6",NULL,NULL,fixtures);
+	
+	return (TestRef)&ResourceManagementTest;
+}
+
+/* End of file resources_s6/task3_instance.c */
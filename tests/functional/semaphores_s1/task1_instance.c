@@ -0,0 +1,95 @@
+/**
+ * @file semaphores_s1/task1_instance.c
+ *
+ * @section desc File description
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline Test Suite
+ *
+ * Trampoline Test Suite is copyright (c) IRCCyN 2005-2007
+ * Trampoline Test Suite is protected by the French intellectual property law.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2
+ * of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+/*Instance of task t1*/
+
+#include "tpl_os.h"
+
+DeclareTask(t2);
+DeclareTask(t3);
+DeclareTask(t4);
+DeclareSemaphore(sem_prio);
+DeclareSemaphore(sem_timed);
+
+/*test case:test the order in which the waiting tasks get the tokens of
+ a semaphore with priority queuing and the timeout of SemTimedWait*/
+static void test_t1_instance(void)
+{
+	StatusType result_inst_1, result_inst_2, result_inst_3, result_inst_4, result_inst_5, result_inst_7;
+	TaskStateType result_inst_6;
+	
+	SCHEDULING_CHECK_INIT(1);
+	result_inst_1 = ActivateTask(t2);
+	SCHEDULING_CHECK_AND_EQUAL_INT(2,E_OK, result_inst_1);
+	
+	SCHEDULING_CHECK_INIT(3);
+	result_inst_2 = ActivateTask(t3);
+	SCHEDULING_CHECK_AND_EQUAL_INT(4,E_OK, result_inst_2);
+	
+	SCHEDULING_CHECK_INIT(5);
+	result_inst_3 = SemPost(sem_prio);
+	SCHEDULING_CHECK_AND_EQUAL_INT(6,E_OK, result_inst_3);
+	
+	SCHEDULING_CHECK_INIT(7);
+	result_inst_4 = SemPost(sem_prio);
+	SCHEDULING_CHECK_AND_EQUAL_INT(8,E_OK, result_inst_4);
+	
+	SCHEDULING_CHECK_INIT(9);
+	result_inst_5 = ActivateTask(t4);
+	SCHEDULING_CHECK_AND_EQUAL_INT(10,E_OK, result_inst_5);
+	
+	/* wait for the timeout of t4 */
+	do
+	{
+		GetTaskState(t4, &result_inst_6);
+	} while (result_inst_6 != SUSPENDED);
+	
+	SCHEDULING_CHECK_INIT(12);
+	result_inst_7 = SemPost(sem_timed);
+	SCHEDULING_CHECK_AND_EQUAL_INT(12,E_OK, result_inst_7);
+	
+}
+
+/*create the test suite with all the test cases*/
+TestRef SemaphoresTest_seq1_t1_instance(void)
+{
+	EMB_UNIT_TESTFIXTURES(fixtures) {
+		new_TestFixture("test_t1_instance",test_t1_instance)
+	};
+	EMB_UNIT_TESTCALLER(SemaphoresTest,"SemaphoresTest_sequence1",NULL,NULL,fixtures);
+	
+	return (TestRef)&SemaphoresTest;
+}
+
+/* End of file semaphores_s1/task1_instance.c */
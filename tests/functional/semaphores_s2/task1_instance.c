@@ -0,0 +1,143 @@
+/**
+ * @file semaphores_s2/task1_instance.c
+ *
+ * @section desc File description
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline Test Suite
+ *
+ * Trampoline Test Suite is copyright (c) IRCCyN 2005-2007
+ * Trampoline Test Suite is protected by the French intellectual property law.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2
+ * of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+/*Instance of task t1*/
+
+#include "tpl_os.h"
+
+DeclareTask(t2);
+DeclareTask(t3);
+DeclareTask(t4);
+DeclareTask(t5);
+DeclareTask(t6);
+DeclareTask(t7);
+DeclareTask(t8);
+DeclareSemaphore(sem_prio);
+DeclareSemaphore(sem_timed);
+
+/*test case:test the FIFO order of the waiting tasks of the same priority
+ with priority queuing and the removal of a timed out task waiting between
+ two other tasks*/
+static void test_t1_instance(void)
+{
+	StatusType result_inst_1, result_inst_2, result_inst_3, result_inst_4, result_inst_5, result_inst_6, result_inst_7, result_inst_8, result_inst_9, result_inst_10, result_inst_11, result_inst_12, result_inst_13, result_inst_14, result_inst_16;
+	TaskStateType result_inst_15;
+	SemWaitStatusType result_inst_17 = SEM_TIMEOUT;
+	
+	/* t2, t3 and t4 have the same priority, t5 a higher one */
+	SCHEDULING_CHECK_INIT(1);
+	result_inst_1 = ActivateTask(t2);
+	SCHEDULING_CHECK_AND_EQUAL_INT(2,E_OK, result_inst_1);
+	
+	SCHEDULING_CHECK_INIT(3);
+	result_inst_2 = ActivateTask(t3);
+	SCHEDULING_CHECK_AND_EQUAL_INT(4,E_OK, result_inst_2);
+	
+	SCHEDULING_CHECK_INIT(5);
+	result_inst_3 = ActivateTask(t4);
+	SCHEDULING_CHECK_AND_EQUAL_INT(6,E_OK, result_inst_3);
+	
+	SCHEDULING_CHECK_INIT(7);
+	result_inst_4 = ActivateTask(t5);
+	SCHEDULING_CHECK_AND_EQUAL_INT(8,E_OK, result_inst_4);
+	
+	/* t5 first, then t2, t3 and t4 in the order they waited */
+	SCHEDULING_CHECK_INIT(9);
+	result_inst_5 = SemPost(sem_prio);
+	SCHEDULING_CHECK_AND_EQUAL_INT(10,E_OK, result_inst_5);
+	
+	SCHEDULING_CHECK_INIT(11);
+	result_inst_6 = SemPost(sem_prio);
+	SCHEDULING_CHECK_AND_EQUAL_INT(12,E_OK, result_inst_6);
+	
+	SCHEDULING_CHECK_INIT(13);
+	result_inst_7 = SemPost(sem_prio);
+	SCHEDULING_CHECK_AND_EQUAL_INT(14,E_OK, result_inst_7);
+	
+	SCHEDULING_CHECK_INIT(15);
+	result_inst_8 = SemPost(sem_prio);
+	SCHEDULING_CHECK_AND_EQUAL_INT(16,E_OK, result_inst_8);
+	
+	/* t6, t7 and t8 wait, the timeout of t7 expires first */
+	SCHEDULING_CHECK_INIT(17);
+	result_inst_9 = ActivateTask(t6);
+	SCHEDULING_CHECK_AND_EQUAL_INT(18,E_OK, result_inst_9);
+	
+	SCHEDULING_CHECK_INIT(19);
+	result_inst_10 = ActivateTask(t7);
+	SCHEDULING_CHECK_AND_EQUAL_INT(20,E_OK, result_inst_10);
+	
+	SCHEDULING_CHECK_INIT(21);
+	result_inst_11 = ActivateTask(t8);
+	SCHEDULING_CHECK_AND_EQUAL_INT(22,E_OK, result_inst_11);
+	
+	/* wait for the timeout of t7 */
+	do
+	{
+		GetTaskState(t7, &result_inst_15);
+	} while (result_inst_15 != SUSPENDED);
+	
+	/* t6 then t8 get the tokens */
+	SCHEDULING_CHECK_INIT(24);
+	result_inst_12 = SemPost(sem_timed);
+	SCHEDULING_CHECK_AND_EQUAL_INT(25,E_OK, result_inst_12);
+	
+	SCHEDULING_CHECK_INIT(26);
+	result_inst_13 = SemPost(sem_timed);
+	SCHEDULING_CHECK_AND_EQUAL_INT(27,E_OK, result_inst_13);
+	
+	/* nobody waits anymore, the token is kept */
+	SCHEDULING_CHECK_INIT(28);
+	result_inst_14 = SemPost(sem_timed);
+	SCHEDULING_CHECK_AND_EQUAL_INT(28,E_OK, result_inst_14);
+	
+	SCHEDULING_CHECK_INIT(29);
+	result_inst_16 = SemTimedWait(sem_timed, 0, &result_inst_17);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(29,E_OK, result_inst_16);
+	SCHEDULING_CHECK_AND_EQUAL_INT(29,SEM_ACQUIRED, result_inst_17);
+	
+}
+
+/*create the test suite with all the test cases*/
+TestRef SemaphoresTest_seq2_t1_instance(void)
+{
+	EMB_UNIT_TESTFIXTURES(fixtures) {
+		new_TestFixture("test_t1_instance",test_t1_instance)
+	};
+	EMB_UNIT_TESTCALLER(SemaphoresTest,"SemaphoresTest_sequence2",NULL,NULL,fixtures);
+	
+	return (TestRef)&SemaphoresTest;
+}
+
+/* End of file semaphores_s2/task1_instance.c */
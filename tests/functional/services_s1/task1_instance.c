@@ -0,0 +1,109 @@
+/**
+ * @file services_s1/task1_instance.c
+ *
+ * @section desc File description
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline Test Suite
+ *
+ * Trampoline Test Suite is copyright (c) IRCCyN 2005-2007
+ * Trampoline Test Suite is protected by the French intellectual property law.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2
+ * of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+/*Instance of task t1*/
+
+#include "tpl_os.h"
+
+DeclareTask(t2);
+DeclareTask(t3);
+
+static uint32 histogram_sum(ServiceStatsType *stats)
+{
+	uint32 sum = 0;
+	int bucket;
+	for (bucket = 0; bucket < SERVICE_STATS_BUCKET_COUNT; bucket++)
+	{
+		sum += stats->histogram[bucket];
+	}
+	return sum;
+}
+
+/*test case:test the statistics of ActivateTask*/
+static void test_t1_instance(void)
+{
+	StatusType result_inst_1, result_inst_2, result_inst_3, result_inst_4, result_inst_5, result_inst_6, result_inst_7;
+	ServiceStatsType stats;
+	
+	SCHEDULING_CHECK_INIT(1);
+	result_inst_1 = GetServiceStats(OSServiceId_ActivateTask, &stats);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(1,E_OK, result_inst_1);
+	SCHEDULING_CHECK_AND_EQUAL_INT(1,0, stats.count);
+	
+	SCHEDULING_CHECK_INIT(2);
+	result_inst_2 = ActivateTask(t2);
+	SCHEDULING_CHECK_AND_EQUAL_INT(2,E_OK, result_inst_2);
+	
+	SCHEDULING_CHECK_INIT(3);
+	result_inst_3 = ActivateTask(t2);
+	SCHEDULING_CHECK_AND_EQUAL_INT(3,E_OK, result_inst_3);
+	
+	SCHEDULING_CHECK_INIT(4);
+	result_inst_4 = ActivateTask(t2);
+	SCHEDULING_CHECK_AND_EQUAL_INT(4,E_OK, result_inst_4);
+	
+	SCHEDULING_CHECK_INIT(5);
+	result_inst_5 = GetServiceStats(OSServiceId_ActivateTask, &stats);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(5,E_OK, result_inst_5);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(5,3, stats.count);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(5,3, histogram_sum(&stats));
+	SCHEDULING_CHECK_AND_EQUAL_INT(5,1, stats.min <= stats.max);
+	
+	SCHEDULING_CHECK_INIT(6);
+	result_inst_6 = ActivateTask(t3);
+	SCHEDULING_CHECK_AND_EQUAL_INT(7,E_OK, result_inst_6);
+	
+	SCHEDULING_CHECK_INIT(8);
+	result_inst_7 = GetServiceStats(OSServiceId_ActivateTask, &stats);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(8,E_OK, result_inst_7);
+	SCHEDULING_CHECK_AND_EQUAL_INT_FIRST(8,4, stats.count);
+	SCHEDULING_CHECK_AND_EQUAL_INT(8,4, histogram_sum(&stats));
+	
+	SCHEDULING_CHECK_INIT(9);
+	result_inst_7 = GetServiceStats(SYSCALL_COUNT, &stats);
+	SCHEDULING_CHECK_AND_EQUAL_INT(9,E_OS_ID, result_inst_7);
+}
+
+/*create the test suite with all the test cases*/
+TestRef ServiceStatsTest_seq1_t1_instance(void)
+{
+	EMB_UNIT_TESTFIXTURES(fixtures) {
+		new_TestFixture("test_t1_instance",test_t1_instance)
+	};
+	EMB_UNIT_TESTCALLER(ServiceStatsTest,"ServiceStatsTest_sequence1",NULL,NULL,fixtures);
+	
+	return (TestRef)&ServiceStatsTest;
+}
+
+/* End of file services_s1/task1_instance.c */
@@ -0,0 +1,82 @@
+/**
+ * @file sharedstack_s1/task1_instance.c
+ *
+ * @section desc File description
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline Test Suite
+ *
+ * Trampoline Test Suite is copyright (c) IRCCyN 2005-2007
+ * Trampoline Test Suite is protected by the French intellectual property law.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2
+ * of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+/*Instance of task t1*/
+
+#include "tpl_os.h"
+
+#define PATTERN_SIZE 64
+
+DeclareTask(t2);
+
+/*test case:test the stack of t1 is left untouched by the tasks that preempt it*/
+static void test_t1_instance(void)
+{
+	StatusType result_inst_1;
+	volatile uint32 pattern[PATTERN_SIZE];
+	uint32 i;
+	uint32 intact = 1;
+	
+	for (i = 0; i < PATTERN_SIZE; i++)
+	{
+		pattern[i] = 0x5A5A0000 + i;
+	}
+	
+	SCHEDULING_CHECK_INIT(1);
+	result_inst_1 = ActivateTask(t2);
+	SCHEDULING_CHECK_AND_EQUAL_INT(8,E_OK, result_inst_1);
+	
+	for (i = 0; i < PATTERN_SIZE; i++)
+	{
+		if (pattern[i] != 0x5A5A0000 + i)
+		{
+			intact = 0;
+		}
+	}
+	SCHEDULING_CHECK_INIT(9);
+	SCHEDULING_CHECK_AND_EQUAL_INT(9,1, intact);
+}
+
+/*create the test suite with all the test cases*/
+TestRef SharedStackTest_seq1_t1_instance(void)
+{
+	EMB_UNIT_TESTFIXTURES(fixtures) {
+		new_TestFixture("test_t1_instance",test_t1_instance)
+	};
+	EMB_UNIT_TESTCALLER(SharedStackTest,"SharedStackTest_sequence1",NULL,NULL,fixtures);
+	
+	return (TestRef)&SharedStackTest;
+}
+
+/* End of file sharedstack_s1/task1_instance.c */
@@ -0,0 +1,92 @@
+/**
+ * @file sharedstack_s1/task2_instance.c
+ *
+ * @section desc File description
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline Test Suite
+ *
+ * Trampoline Test Suite is copyright (c) IRCCyN 2005-2007
+ * Trampoline Test Suite is protected by the French intellectual property law.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2
+ * of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+/*Instance of task t2*/
+
+#include "tpl_os.h"
+
+#define PATTERN_SIZE 64
+
+DeclareTask(t3);
+DeclareTask(t4);
+
+/* address of a local of t2, compared to the one of t3 */
+unsigned long t2_local;
+
+/*test case:test the stack of t2 is left untouched by the tasks that preempt it*/
+static void test_t2_instance(void)
+{
+	StatusType result_inst_1, result_inst_2;
+	volatile uint32 pattern[PATTERN_SIZE];
+	uint32 i;
+	uint32 intact = 1;
+	
+	for (i = 0; i < PATTERN_SIZE; i++)
+	{
+		pattern[i] = 0xA5A50000 + i;
+	}
+	
+	SCHEDULING_CHECK_INIT(2);
+	result_inst_1 = ActivateTask(t3);
+	SCHEDULING_CHECK_AND_EQUAL_INT(2,E_OK, result_inst_1);
+	
+	SCHEDULING_CHECK_INIT(3);
+	result_inst_2 = ActivateTask(t4);
+	SCHEDULING_CHECK_AND_EQUAL_INT(6,E_OK, result_inst_2);
+	
+	for (i = 0; i < PATTERN_SIZE; i++)
+	{
+		if (pattern[i] != 0xA5A50000 + i)
+		{
+			intact = 0;
+		}
+	}
+	SCHEDULING_CHECK_INIT(7);
+	SCHEDULING_CHECK_AND_EQUAL_INT(7,1, intact);
+	
+	t2_local = (unsigned long)&pattern[0];
+}
+
+/*create the test suite with all the test cases*/
+TestRef SharedStackTest_seq1_t2_instance(void)
+{
+	EMB_UNIT_TESTFIXTURES(fixtures) {
+		new_TestFixture("test_t2_instance",test_t2_instance)
+	};
+	EMB_UNIT_TESTCALLER(SharedStackTest,"SharedStackTest_sequence1",NULL,NULL,fixtures);
+	
+	return (TestRef)&SharedStackTest;
+}
+
+/* End of file sharedstack_s1/task2_instance.c */
@@ -0,0 +1,64 @@
+/**
+ * @file sharedstack_s1/task3_instance.c
+ *
+ * @section desc File description
+ *
+ * @section copyright Copyright
+ *
+ * Trampoline Test Suite
+ *
+ * Trampoline Test Suite is copyright (c) IRCCyN 2005-2007
+ * Trampoline Test Suite is protected by the French intellectual property law.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2
+ * of the License.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section infos File informations
+ *
+ * $Date$
+ * $Rev$
+ * $Author$
+ * $URL$
+ */
+
+/*Instance of task t3*/
+
+#include "tpl_os.h"
+
+#define PATTERN_SIZE 64
+
+extern unsigned long t2_local;
+
+/*test case:test t3 runs in the stack slice of t2, both have the same priority*/
+static void test_t3_instance(void)
+{
+	volatile uint32 pattern[PATTERN_SIZE];
+	long distance = (long)((unsigned long)&pattern[0] - t2_local);
+	
+	SCHEDULING_CHECK_INIT(8);
+	SCHEDULING_CHECK_AND_EQUAL_INT(8,1, (distance > -4096) && (distance < 4096));
+}
+
+/*create the test suite with all the test cases*/
+TestRef SharedStackTest_seq1_t3_instance(void)
+{
+	EMB_UNIT_TESTFIXTURES(fixtures) {
+		new_TestFixture("test_t3_instance",test_t3_instance)
+	};
+	EMB_UNIT_TESTCALLER(SharedStackTest,"SharedStackTest_sequence1",NULL,NULL,fixtures);
+	
+	return (TestRef)&SharedStackTest;
+}
+
+/* End of file sharedstack_s1/task3_instance.c */